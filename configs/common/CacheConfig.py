@@ -43,6 +43,7 @@
 
 import m5
 from m5.objects import *
+from m5.util import fatal
 from Caches import *
 
 def config_cache(options, system):
@@ -80,13 +81,23 @@ def config_cache(options, system):
     if options.l2cache and options.elastic_trace_en:
         fatal("When elastic trace is enabled, do not configure L2 caches.")
 
-    if options.l2cache:
+    # With --parallel-eventqs every core gets a private L2 and runs on an
+    # event queue of its own, only the crossbar below the L2s is shared
+    parallel = getattr(options, 'parallel_eventqs', False)
+    if parallel and (not options.caches or not options.l2cache):
+        fatal("--parallel-eventqs needs --caches --l2cache")
+
+    if options.l2cache and not parallel:
         # Provide a clock for the L2 and the L1-to-L2 bus here as they
         # are not connected using addTwoLevelCacheHierarchy. Use the
         # same clock as the CPUs.
         system.l2 = l2_cache_class(clk_domain=system.cpu_clk_domain,
                                    size=options.l2_size,
                                    assoc=options.l2_assoc)
+        if options.l2_hwp_type:
+            _setPrefetcher(system.l2, options.l2_hwp_type)
+        if options.l2_repl_policy or options.l2_compressor:
+            system.l2.tags = _l2Tags(options)
 
         system.tol2bus = L2XBar(clk_domain = system.cpu_clk_domain)
         system.l2.cpu_side = system.tol2bus.master
@@ -101,6 +112,8 @@ def config_cache(options, system):
                                   assoc=options.l1i_assoc)
             dcache = dcache_class(size=options.l1d_size,
                                   assoc=options.l1d_assoc)
+            if options.l1d_hwp_type:
+                _setPrefetcher(dcache, options.l1d_hwp_type)
 
             # If we have a walker cache specified, instantiate two
             # instances here
@@ -137,6 +150,18 @@ def config_cache(options, system):
                 system.cpu[i].dcache = dcache_real
                 system.cpu[i].dcache_mon = dcache_mon
 
+            if parallel:
+                system.cpu[i].l2cache = l2_cache_class(
+                    clk_domain=system.cpu_clk_domain, size=options.l2_size,
+                    assoc=options.l2_assoc)
+                if options.l2_hwp_type:
+                    _setPrefetcher(system.cpu[i].l2cache,
+                                   options.l2_hwp_type)
+                if options.l2_repl_policy or options.l2_compressor:
+                    system.cpu[i].l2cache.tags = _l2Tags(options)
+                system.cpu[i].toL2Bus = L2XBar(
+                    clk_domain=system.cpu_clk_domain)
+
         elif options.external_memory_system:
             # These port names are presented to whatever 'external' system
             # gem5 is connecting to.  Its configuration will likely depend
@@ -155,7 +180,9 @@ def config_cache(options, system):
                         ExternalCache("cpu%d.dcache" % i))
 
         system.cpu[i].createInterruptController()
-        if options.l2cache:
+        if parallel:
+            connectParallelPorts(options, system.cpu[i], system.membus)
+        elif options.l2cache:
             system.cpu[i].connectAllPorts(system.tol2bus, system.membus)
         elif options.external_memory_system:
             system.cpu[i].connectUncachedPorts(system.membus)
@@ -164,6 +191,67 @@ def config_cache(options, system):
 
     return system
 
+def _setPrefetcher(cache, hwp_type):
+    hwp_class = getattr(m5.objects, hwp_type, None)
+    if not isinstance(hwp_class, type) or \
+       not issubclass(hwp_class, BasePrefetcher):
+        fatal("%s is not a hardware prefetcher", hwp_type)
+    cache.prefetcher = hwp_class()
+    # The indirect prefetcher reads its indices out of the lines that
+    # hit, so it has to see every access, not just misses
+    if issubclass(hwp_class, IndirectMemoryPrefetcher):
+        cache.prefetch_on_access = True
+
+def _l2Tags(options):
+    kwargs = {}
+    if options.l2_repl_policy:
+        rp_class = getattr(m5.objects, options.l2_repl_policy, None)
+        if not isinstance(rp_class, type) or \
+           not issubclass(rp_class, BaseReplacementPolicy):
+            fatal("%s is not a replacement policy", options.l2_repl_policy)
+        kwargs['replacement_policy'] = rp_class()
+
+    if not options.l2_compressor:
+        return SetAssoc(**kwargs)
+
+    comp_class = getattr(m5.objects, options.l2_compressor, None)
+    if not isinstance(comp_class, type) or \
+       not issubclass(comp_class, BaseCacheCompressor):
+        fatal("%s is not a cache compressor", options.l2_compressor)
+    return CompressedTags(compressor=comp_class(),
+                          max_compression_ratio=options.l2_compression_ratio,
+                          **kwargs)
+
+def _parallelBridge(options, **kwargs):
+    return EventQueueBridge(delay=options.parallel_link_latency,
+                            deterministic=options.parallel_deterministic,
+                            **kwargs)
+
+# Connect a core simulated on an event queue of its own, see
+# config_cache. The private L2 and the interrupt controller reach the
+# crossbar on event queue 0 through event queue bridges, whose slave side
+# is on the event queue of the bridge and master side on
+# master_eventq_index.
+def connectParallelPorts(options, cpu, membus):
+    cpu.connectCachedPorts(cpu.toL2Bus)
+    cpu.toL2Bus.master = cpu.l2cache.cpu_side
+    cpu.l2bridge = _parallelBridge(options, master_eventq_index=0)
+    cpu.l2cache.mem_side = cpu.l2bridge.slave
+    cpu.l2bridge.master = membus.slave
+
+    uncached_bridges = []
+    for p in cpu._uncached_slave_ports:
+        b = _parallelBridge(options, eventq_index=0)
+        b.slave = membus.master
+        exec('cpu.%s = b.master' % p)
+        uncached_bridges.append(b)
+    for p in cpu._uncached_master_ports:
+        b = _parallelBridge(options, master_eventq_index=0)
+        exec('b.slave = cpu.%s' % p)
+        b.master = membus.slave
+        uncached_bridges.append(b)
+    cpu.uncached_bridges = uncached_bridges
+
 # ExternalSlave provides a "port", but when that port connects to a cache,
 # the connecting CPU SimObject wants to refer to its "cpu_side".
 # The 'ExternalCache' class provides this adaptation by rewriting the name,
@@ -124,6 +124,16 @@ def config_scheme(cpu_cls, cpu_list, options):
             else:
                 raise ValueError("DOPP must be 0 or 1")
 
+            if cpu.DOPP and options.dopp_addr_pred != "None":
+                pred_cls = getattr(m5.objects,
+                                   options.dopp_addr_pred + "DoppPredictor")
+                cpu.doppAddrPred = pred_cls(numThreads = cpu.numThreads)
+                print "DOPP address predictor: %s" % options.dopp_addr_pred
+
+            if cpu.DOPP and options.dopp_selective_replay:
+                cpu.doppSelectiveReplay = True
+                print "DOPP selective replay is set"
+
             if options.implicit_channel:
                 cpu.implicitChannel = True;
             else:
@@ -138,6 +148,16 @@ def config_scheme(cpu_cls, cpu_list, options):
                 cpu.moreTransmitInsts = options.moreTransmitInsts
             else:
                 cpu.moreTransmitInsts = 0
+
+            cpu.taintEngine = options.taint_engine
+            if options.check_taint:
+                cpu.checkTaint = True
+            else:
+                cpu.checkTaint = False
+            if options.gate_quiescent_tick:
+                cpu.gateQuiescentTick = True
+            else:
+                cpu.gateQuiescentTick = False
     else:
         print "not DerivO3CPU"
 
@@ -110,6 +110,29 @@ def addNoISAOptions(parser):
     parser.add_option("--l2_assoc", type="int", default=8)
     parser.add_option("--l3_assoc", type="int", default=16)
     parser.add_option("--cacheline_size", type="int", default=64)
+    parser.add_option("--l1d-hwp-type", type="string", default=None,
+                      help="""Hardware prefetcher of the L1 data caches,
+                      e.g. StridePrefetcher or IndirectMemoryPrefetcher
+                      (default: none)""")
+    parser.add_option("--l2-hwp-type", type="string", default=None,
+                      help="""Hardware prefetcher of the L2 caches
+                      (default: none)""")
+    parser.add_option("--l2-repl-policy", type="string", default=None,
+                      help="""Replacement policy of the L2 caches, e.g.
+                      DRRIPRP, SHiPRP or HawkeyeRP (default: the LRU
+                      tags)""")
+    parser.add_option("--l2-compressor", type="string", default=None,
+                      help="""Store the L2 blocks compressed with this
+                      model, BDI or FPC (default: uncompressed)""")
+    parser.add_option("--l2-compression-ratio", type="int", default=2,
+                      help="""With --l2-compressor, the most blocks an L2
+                      set holds per way""")
+    parser.add_option("--l1d-hwp-train-on", type="choice", default="all",
+                      choices=["all", "visible", "doppelganger"],
+                      help="""Accesses that train the L1D prefetchers with
+                      STT: all, visible (only unsquashable accesses, and
+                      loads once they commit) or doppelganger (visible and
+                      doppelganger loads)""")
 
     # Enable Ruby
     parser.add_option("--ruby", action="store_true")
@@ -201,6 +224,48 @@ def addCommonOptions(parser):
                       action="store", type="string",
                       help="Link delay in seconds\nDEFAULT: 10us")
 
+    # Multi-threaded simulation options
+    parser.add_option("--parallel-eventqs", action="store_true",
+                      help="""Simulate every core with its private caches on
+                      an event queue and host thread of its own; the shared
+                      crossbar and memory stay on event queue 0. Needs
+                      --caches --l2cache and timing CPUs whose workloads do
+                      not share memory.""")
+    parser.add_option("--parallel-link-latency", action="store",
+                      type="string", default="10ns",
+                      help="""Latency between a core's private L2 and the
+                      shared crossbar when running with --parallel-eventqs
+                      \nDEFAULT: 10ns""")
+    parser.add_option("--sim-quantum", action="store", type="string",
+                      default=None,
+                      help="""Simulated time the event queues may run apart
+                      between synchronisations\nDEFAULT:
+                      --parallel-link-latency""")
+    parser.add_option("--parallel-deterministic", action="store_true",
+                      default=False,
+                      help="""Make timing traffic between the event queues
+                      independent of the host thread interleaving; needs a
+                      quantum no longer than --parallel-link-latency""")
+
+    # Stat sampling options
+    parser.add_option("--stat-sample", action="append", type="string",
+                      default=[],
+                      help="""Regular expression of the stats to sample every
+                      --stat-sample-period without dumping or resetting
+                      them, can be repeated (e.g. 'cpu.ipc',
+                      'rob.occupancy', 'stallListOccupancy')""")
+    parser.add_option("--stat-sample-period", action="store",
+                      type="string", default="5us",
+                      help="Time between samples\nDEFAULT: 5us")
+    parser.add_option("--stat-sample-file", action="store", type="string",
+                      default="stats_sample.bin",
+                      help="""Output file of the samples, readable with
+                      sample_scripts/stats_bin.py\nDEFAULT:
+                      stats_sample.bin""")
+    parser.add_option("--stat-sample-buffer", action="store", type="int",
+                      default=4096,
+                      help="Samples buffered for the writer thread")
+
     # Run duration options
     parser.add_option("-I", "--maxinsts", action="store", type="int",
                       default=None, help="""Total number of instructions to
@@ -246,6 +311,10 @@ def addCommonOptions(parser):
         help="restore from checkpoint <N>")
     parser.add_option("--checkpoint-at-end", action="store_true",
                       help="take a checkpoint at end of run")
+    parser.add_option("--roi-checkpoint", action="store_true", default=False,
+                      help="""fast forward to the region of interest (see
+                      --fast-forward and --fast-forward-pseudo-inst), take a
+                      checkpoint there and exit. Restore it with -r 1.""")
     parser.add_option("--work-begin-checkpoint-count", action="store", type="int",
                       help="checkpoint at specified work begin count")
     parser.add_option("--work-end-checkpoint-count", action="store", type="int",
@@ -305,12 +374,24 @@ def addCommonOptions(parser):
             help="Whether using STT mechanism(threat_model mustn't be Unsafe.")
     parser.add_option("--DOPP", default=None, action="store", type="int",
             help="Whether using DOPP optimization(STT should be enabled).")
+    parser.add_option("--dopp_addr_pred", default="None", action="store", type="choice",
+            choices=["None", "LastAddr", "Stride", "Context"],
+            help="Address predictor for doppelganger loads")
+    parser.add_option("--dopp_selective_replay", default=0, action="store", type="int",
+            help="Replay dependents instead of squashing on a doppelganger address misprediction")
     parser.add_option("--implicit_channel", default=None, action="store", type="int",
             help="Whether enabling defense mechanism for implicit channel")
     parser.add_option("--ifPrintROB", default=None, action="store", type="int",
             help="Enable printing ROB content at every cycle")
     parser.add_option("--moreTransmitInsts", default=None, action="store", type="int",
             help="Include more transmit instruction types.")
+    parser.add_option("--taint_engine", default="Full", action="store", type="choice",
+            choices=["Full", "Incremental", "BitVector"],
+            help="STT taint propagation engine")
+    parser.add_option("--check_taint", default=None, action="store", type="int",
+            help="Cross-check the taint engine against a full ROB walk")
+    parser.add_option("--gate_quiescent_tick", default=None, action="store", type="int",
+            help="Skip O3 cycles in bulk while the pipeline only waits on memory")
 
 def addSEOptions(parser):
     # Benchmark options
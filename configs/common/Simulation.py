@@ -387,6 +387,34 @@ def takeSimpointCheckpoints(simpoints, interval_length, cptdir):
     print "%d checkpoints taken" % num_checkpoints
     sys.exit(code)
 
+def takeROICheckpoint(options, cptdir):
+    """Fast forward with the atomic CPU to the region of interest and
+    checkpoint it, so that a sweep of detailed configurations can all be
+    restored from the same state instead of each re-running the setup.
+
+    The region starts after --fast-forward instructions, or at the first
+    m5_switchcpu() pseudo instruction with --fast-forward-pseudo-inst.
+    """
+    exit_event = m5.simulate()
+    exit_cause = exit_event.getCause()
+
+    if options.fast_forward_pseudo_inst:
+        # skip checkpoint instructions should they exist
+        while exit_cause == "checkpoint":
+            exit_event = m5.simulate()
+            exit_cause = exit_event.getCause()
+
+        if exit_cause != "switchcpu":
+            fatal("Region of interest not reached, exited because %s",
+                  exit_cause)
+    elif exit_cause != "a thread reached the max instruction count":
+        fatal("Fast forward of %s instructions stopped early because %s",
+              options.fast_forward, exit_cause)
+
+    print "Creating ROI checkpoint @ tick %d" % m5.curTick()
+    m5.checkpoint(joinpath(cptdir, "cpt.%d"))
+    return exit_event
+
 def restoreSimpointCheckpoint():
     exit_event = m5.simulate()
     exit_cause = exit_event.getCause()
@@ -426,6 +454,56 @@ def repeatSwitch(testsys, repeat_switch_cpu_list, maxtick, switch_freq):
             exit_event = m5.simulate(maxtick - m5.curTick())
             return exit_event
 
+def configParallelEventQueues(options, root, testsys):
+    # Core i and everything below it in the hierarchy (its caches, TLBs,
+    # interrupt controller and workload) run on event queue i + 1, the
+    # rest of the system on event queue 0; CacheConfig.config_cache put
+    # bridges on the links between them. The CPUs switched in later use
+    # the caches of testsys.cpu[i], so they go on the same queue.
+    for cpus in ['cpu', 'switch_cpus', 'switch_cpus_1', 'repeat_switch_cpus']:
+        try:
+            cpu_list = getattr(testsys, cpus)
+        except AttributeError:
+            continue
+        for i, cpu in enumerate(cpu_list):
+            cpu.eventq_index = i + 1
+
+    m5.ticks.fixGlobalFrequency()
+    link_latency = m5.ticks.fromSeconds(
+        convert.anyToLatency(options.parallel_link_latency))
+    if options.sim_quantum:
+        quantum = m5.ticks.fromSeconds(
+            convert.anyToLatency(options.sim_quantum))
+    else:
+        quantum = link_latency
+
+    if options.parallel_deterministic and quantum > link_latency:
+        fatal("--parallel-deterministic needs a --sim-quantum no longer "
+              "than --parallel-link-latency")
+
+    root.sim_quantum = quantum
+    inform("Simulating %d cores on %d event queues, %d tick quantum%s",
+           len(testsys.cpu), len(testsys.cpu) + 1, quantum,
+           " (deterministic)" if options.parallel_deterministic else "")
+
+def configPrefetchTraining(options, testsys):
+    # Loads that are not trained on when they access the L1D train its
+    # prefetcher when they commit, on whichever of the CPUs sharing the
+    # cache is switched in
+    for i, cpu in enumerate(testsys.cpu):
+        dcache = getattr(cpu, 'dcache', None)
+        prefetcher = getattr(dcache, 'prefetcher', None)
+        if not isinstance(prefetcher, BasePrefetcher):
+            continue
+        sources = [cpu]
+        for cpus in ['switch_cpus', 'switch_cpus_1', 'repeat_switch_cpus']:
+            try:
+                sources.append(getattr(testsys, cpus)[i])
+            except AttributeError:
+                pass
+        prefetcher.train_on = options.l1d_hwp_train_on
+        prefetcher.commit_sources = sources
+
 def run(options, root, testsys, cpu_class):
     if options.checkpoint_dir:
         cptdir = options.checkpoint_dir
@@ -449,6 +527,16 @@ def run(options, root, testsys, cpu_class):
     if options.repeat_switch and options.take_checkpoints:
         fatal("Can't specify both --repeat-switch and --take-checkpoints")
 
+    if options.roi_checkpoint and not cpu_class:
+        fatal("--roi-checkpoint needs --fast-forward or "
+              "--fast-forward-pseudo-inst")
+
+    if options.roi_checkpoint and \
+            (options.take_checkpoints or options.standard_switch or
+             options.repeat_switch):
+        fatal("Can't combine --roi-checkpoint with other checkpointing "
+              "or switching options")
+
     np = options.num_cpus
     switch_cpus = None
 
@@ -603,6 +691,19 @@ def run(options, root, testsys, cpu_class):
     if options.take_simpoint_checkpoints != None:
         simpoints, interval_length = parseSimpointAnalysisFile(options, testsys)
 
+    if options.l1d_hwp_train_on != "all":
+        configPrefetchTraining(options, testsys)
+
+    if options.parallel_eventqs:
+        configParallelEventQueues(options, root, testsys)
+
+    if options.stat_sample:
+        testsys.stat_sampler = StatSampler(
+            stats=options.stat_sample,
+            period=options.stat_sample_period,
+            file=options.stat_sample_file,
+            buffer_size=options.stat_sample_buffer)
+
     checkpoint_dir = None
     if options.checkpoint_restore:
         cpt_starttick, checkpoint_dir = findCptDir(options, cptdir, testsys)
@@ -615,6 +716,16 @@ def run(options, root, testsys, cpu_class):
     if options.initialize_only:
         return
 
+    # The detailed CPUs are only instantiated so that the checkpoint has
+    # the same layout as the runs restoring it
+    if options.roi_checkpoint:
+        exit_event = takeROICheckpoint(options, cptdir)
+        print 'Exiting @ tick %i because %s' % \
+              (m5.curTick(), exit_event.getCause())
+        if not m5.options.interactive:
+            sys.exit(exit_event.getCode())
+        return
+
     # Handle the max tick settings now that tick frequency was resolved
     # during system instantiation
     # NOTE: the maxtick variable here is in absolute ticks, so it must
@@ -717,7 +828,9 @@ def run(options, root, testsys, cpu_class):
         restoreSimpointCheckpoint()
 
     else:
-        if options.fast_forward or options.fast_forward_pseudo_inst:
+        # only measure the CPU we switched to
+        if options.fast_forward or options.fast_forward_pseudo_inst or \
+                (cpu_class and options.checkpoint_restore != None):
             m5.stats.reset()
         print "**** REAL SIMULATION ****"
 
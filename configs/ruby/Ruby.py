@@ -79,6 +79,10 @@ def define_options(parser):
     parser.add_option("--enable-prefetch", action="store_true", default=False,
                       help="Enable Ruby HW Prefetcher")
 
+    parser.add_option("--spec-buffer-size", type="int", default=None,
+                      help="Entries in each sequencer's InvisiSpec spec " \
+                           "buffer, at least the LQ size plus one")
+
     protocol = buildEnv['PROTOCOL']
     exec "import %s" % protocol
     eval("%s.define_options(parser)" % protocol)
@@ -180,6 +184,10 @@ def create_system(options, full_system, system, piobus = None, dma_ports = []):
 
     setup_memory_controllers(system, ruby, dir_cntrls, options)
 
+    if options.spec_buffer_size:
+        for cpu_seq in cpu_sequencers:
+            cpu_seq.spec_buffer_size = options.spec_buffer_size
+
     # Connect the cpu sequencers and the piobus
     if piobus != None:
         for cpu_seq in cpu_sequencers:
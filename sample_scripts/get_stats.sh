@@ -22,9 +22,11 @@ for gap_exe in "${gap_executables[@]}"; do
     EXE_PATH=../gapbs/$gap_exe
     CONFIG_FILE=$STT_PATH/configs/example/se.py
 
-    orig_tick=$(cat $STT_PATH/orig_outputs/$gap_exe/out | grep Exit | awk '{print $4}')
-    stt_tick=$(cat $STT_PATH/stt_outputs/$gap_exe/out | grep Exit | awk '{print $4}')
-    dopp_tick=$(cat $STT_PATH/dopp_outputs/$gap_exe/out | grep Exit | awk '{print $4}')
+    # sim_ticks rather than the exit tick, which also counts the ticks
+    # fast forwarded before a restored checkpoint
+    orig_tick=$(grep -m 1 "^sim_ticks" $STT_PATH/orig_outputs/$gap_exe/stats.txt | awk '{print $2}')
+    stt_tick=$(grep -m 1 "^sim_ticks" $STT_PATH/stt_outputs/$gap_exe/stats.txt | awk '{print $2}')
+    dopp_tick=$(grep -m 1 "^sim_ticks" $STT_PATH/dopp_outputs/$gap_exe/stats.txt | awk '{print $2}')
 
     printf "'%s': %s,\n" \
         "$gap_exe" \
@@ -2,9 +2,18 @@
 
 STT_PATH=.
 
+GEM5=$STT_PATH/build/X86_MESI_Two_Level/gem5.opt
+CONFIG_FILE=$STT_PATH/configs/example/se.py
+
 GRAPHSIZE=14
 ITERS=4
 
+# The region of interest starts at the first m5_switchcpu() of the kernel,
+# or after FF_INSTS instructions when it is set (e.g. FF_INSTS=500000000)
+FF_INSTS=${FF_INSTS:-}
+# Instructions to simulate in detail from the checkpoint, 0 runs to the end
+MAX_INSTS=${MAX_INSTS:-0}
+
 # Define a list of GAP executables
 gap_executables=(
     "bc"
@@ -17,55 +26,71 @@ gap_executables=(
     "tc"
 )
 
+# Detailed configurations restored from the same checkpoint, as
+# "<output prefix>|<options>"; results go to <output prefix>_outputs
+sweep_configs=(
+    "orig|--STT=0 --implicit_channel=0 --DOPP=0"
+    "stt|--STT=1 --implicit_channel=1 --DOPP=0"
+    "dopp|--STT=1 --implicit_channel=1 --DOPP=1"
+)
+
+SYS_OPTS="--num-cpus=1 --mem-size=4GB \
+    --caches --l2cache --cpu-type=DerivO3CPU \
+    --threat_model=Spectre --needsTSO=1 \
+    --moreTransmitInsts=0 --ifPrintROB=0"
+
+if [ -n "$FF_INSTS" ]; then
+    FF_OPTS="--fast-forward=$FF_INSTS"
+else
+    FF_OPTS="--fast-forward-pseudo-inst"
+fi
+
+DETAIL_OPTS=""
+if [ "$MAX_INSTS" -gt 0 ]; then
+    DETAIL_OPTS="--maxinsts=$MAX_INSTS"
+fi
+
 # Iterate through the list
 for gap_exe in "${gap_executables[@]}"; do
     echo "Processing: $gap_exe"
 
     EXE_PATH=../gapbs/$gap_exe
-    CONFIG_FILE=$STT_PATH/configs/example/se.py
+    # --checkpoint-dir has to be absolute
+    CPT_DIR=$(realpath -m $STT_PATH/checkpoints/$gap_exe)
 
     # --------------------------------------------------------------- #
-    OUT_DIR=$STT_PATH/orig_outputs/$gap_exe
-    mkdir -p $OUT_DIR
-    $STT_PATH/build/X86_MESI_Two_Level/gem5.opt --outdir=$OUT_DIR \
+    # Fast forward once with AtomicSimpleCPU and checkpoint the ROI
+    rm -rf $CPT_DIR
+    mkdir -p $CPT_DIR
+    $GEM5 --outdir=$CPT_DIR \
     $CONFIG_FILE \
-    --num-cpus=1 --mem-size=4GB \
-    --caches --l2cache --cpu-type=DerivO3CPU \
-    --threat_model=Spectre --needsTSO=1 --STT=0 --implicit_channel=0 \
-    --moreTransmitInsts=0 --ifPrintROB=0 \
-    --DOPP=0 \
+    $SYS_OPTS --STT=0 --implicit_channel=0 --DOPP=0 \
+    $FF_OPTS --roi-checkpoint --checkpoint-dir=$CPT_DIR \
     -c $EXE_PATH \
-    -o "-g $GRAPHSIZE -n $ITERS" 1>$OUT_DIR/out 2>$OUT_DIR/err&
-    # --------------------------------------------------------------- #
-    # --------------------------------------------------------------- #
-    OUT_DIR=$STT_PATH/stt_outputs/$gap_exe
-    mkdir -p $OUT_DIR
-    $STT_PATH/build/X86_MESI_Two_Level/gem5.opt --outdir=$OUT_DIR \
-    $CONFIG_FILE \
-    --num-cpus=1 --mem-size=4GB \
-    --caches --l2cache --cpu-type=DerivO3CPU \
-    --threat_model=Spectre --needsTSO=1 --STT=1 --implicit_channel=1 \
-    --moreTransmitInsts=0 --ifPrintROB=0 \
-    --DOPP=0 \
-    -c $EXE_PATH \
-    -o "-g $GRAPHSIZE -n $ITERS" 1>$OUT_DIR/out 2>$OUT_DIR/err&
-    # --------------------------------------------------------------- #
+    -o "-g $GRAPHSIZE -n $ITERS" 1>$CPT_DIR/out 2>$CPT_DIR/err
+
+    if ! ls -d $CPT_DIR/cpt.* > /dev/null 2>&1; then
+        echo "No checkpoint for $gap_exe, see $CPT_DIR/err"
+        continue
+    fi
     # --------------------------------------------------------------- #
-    OUT_DIR=$STT_PATH/dopp_outputs/$gap_exe
-    mkdir -p $OUT_DIR
-    $STT_PATH/build/X86_MESI_Two_Level/gem5.opt --outdir=$OUT_DIR \
-    $CONFIG_FILE \
-    --num-cpus=1 --mem-size=4GB \
-    --caches --l2cache --cpu-type=DerivO3CPU \
-    --threat_model=Spectre --needsTSO=1 --STT=1 --implicit_channel=1 \
-    --moreTransmitInsts=0 --ifPrintROB=0 \
-    --DOPP=1 \
-    -c $EXE_PATH \
-    -o "-g $GRAPHSIZE -n $ITERS" 1>$OUT_DIR/out 2>$OUT_DIR/err&
+    # Restore every configuration from that checkpoint in parallel
+    for sweep_config in "${sweep_configs[@]}"; do
+        prefix=${sweep_config%%|*}
+        config_opts=${sweep_config#*|}
+
+        OUT_DIR=$STT_PATH/${prefix}_outputs/$gap_exe
+        mkdir -p $OUT_DIR
+        $GEM5 --outdir=$OUT_DIR \
+        $CONFIG_FILE \
+        $SYS_OPTS $config_opts \
+        --checkpoint-dir=$CPT_DIR -r 1 $DETAIL_OPTS \
+        -c $EXE_PATH \
+        -o "-g $GRAPHSIZE -n $ITERS" 1>$OUT_DIR/out 2>$OUT_DIR/err&
+    done
     # --------------------------------------------------------------- #
 
     # Wait for all background processes to finish before continuing
-    wait -n 3
+    wait
     echo "Finished processing: $gap_exe"
-
-done
\ No newline at end of file
+done
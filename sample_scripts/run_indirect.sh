@@ -0,0 +1,30 @@
+#!/bin/bash
+
+# Regression for the indirect memory prefetcher: run the A[B[i]] gather
+# from tests/test-progs/indirect and check that it issued indirect
+# prefetches. Build the test with make in that directory first.
+
+STT_PATH=.
+
+GEM5=$STT_PATH/build/X86_MESI_Two_Level/gem5.opt
+CONFIG_FILE=$STT_PATH/configs/example/se.py
+EXE_PATH=$STT_PATH/tests/test-progs/indirect/indirect
+
+OUT_DIR=$STT_PATH/indirect_outputs
+
+$GEM5 --outdir=$OUT_DIR \
+    $CONFIG_FILE \
+    --num-cpus=1 --mem-size=4GB \
+    --caches --l2cache --cpu-type=DerivO3CPU \
+    --l1d-hwp-type=IndirectMemoryPrefetcher \
+    -c $EXE_PATH \
+    -o "2" || exit 1
+
+PF_INDIRECT=$(awk '$1 ~ /dcache\.prefetcher\.pfIndirect$/ { print $2; exit }' \
+    $OUT_DIR/stats.txt)
+
+if [ -z "$PF_INDIRECT" ] || [ "$PF_INDIRECT" -eq 0 ]; then
+    echo "FAIL: no indirect prefetches issued"
+    exit 1
+fi
+echo "PASS: $PF_INDIRECT indirect prefetches issued"
@@ -0,0 +1,101 @@
+#!/bin/bash
+
+# Sampled STT evaluation of one GAP kernel with SimPoint:
+#   1. profile basic block vectors with AtomicSimpleCPU
+#   2. pick the representative intervals (simpoint_pick.py)
+#   3. checkpoint every SimPoint, WARMUP instructions ahead of it
+#   4. restore every checkpoint with each configuration on DerivO3CPU
+#   5. combine the intervals into a weighted IPC (simpoint_ipc.py)
+# Usage: run_simpoint.sh <gap kernel>
+
+STT_PATH=.
+
+GEM5=$STT_PATH/build/X86_MESI_Two_Level/gem5.opt
+CONFIG_FILE=$STT_PATH/configs/example/se.py
+
+GRAPHSIZE=14
+ITERS=4
+
+INTERVAL=${INTERVAL:-100000000}
+WARMUP=${WARMUP:-1000000}
+MAX_K=${MAX_K:-30}
+# Number of detailed simulations to run at a time
+JOBS=${JOBS:-$(nproc)}
+
+gap_exe=${1:-tc}
+EXE_PATH=../gapbs/$gap_exe
+SP_DIR=$STT_PATH/simpoint_outputs/$gap_exe
+# --checkpoint-dir has to be absolute
+CPT_DIR=$(realpath -m $SP_DIR/checkpoints)
+
+# Detailed configurations, as "<name>|<options>"
+sweep_configs=(
+    "orig|--STT=0 --implicit_channel=0 --DOPP=0"
+    "stt|--STT=1 --implicit_channel=1 --DOPP=0"
+    "dopp|--STT=1 --implicit_channel=1 --DOPP=1"
+)
+
+STT_OPTS="--threat_model=Spectre --needsTSO=1 \
+    --moreTransmitInsts=0 --ifPrintROB=0"
+
+# --------------------------------------------------------------- #
+# Profile and pick the SimPoints
+mkdir -p $SP_DIR/profile
+$GEM5 --outdir=$SP_DIR/profile \
+$CONFIG_FILE \
+--num-cpus=1 --mem-size=4GB \
+--cpu-type=AtomicSimpleCPU --fastmem \
+--simpoint-profile --simpoint-interval=$INTERVAL \
+-c $EXE_PATH \
+-o "-g $GRAPHSIZE -n $ITERS" 1>$SP_DIR/profile/out 2>$SP_DIR/profile/err || exit 1
+
+python3 $STT_PATH/sample_scripts/simpoint_pick.py --max-k=$MAX_K \
+    $SP_DIR/profile/simpoint.bb.gz $SP_DIR/simpoints $SP_DIR/weights || exit 1
+# --------------------------------------------------------------- #
+# Checkpoint every SimPoint in one pass
+rm -rf $CPT_DIR
+mkdir -p $CPT_DIR
+$GEM5 --outdir=$CPT_DIR \
+$CONFIG_FILE \
+--num-cpus=1 --mem-size=4GB \
+--cpu-type=AtomicSimpleCPU \
+--take-simpoint-checkpoints=$SP_DIR/simpoints,$SP_DIR/weights,$INTERVAL,$WARMUP \
+--checkpoint-dir=$CPT_DIR \
+-c $EXE_PATH \
+-o "-g $GRAPHSIZE -n $ITERS" 1>$CPT_DIR/out 2>$CPT_DIR/err
+
+num_cpts=$(ls -d $CPT_DIR/cpt.simpoint_* 2> /dev/null | wc -l)
+if [ $num_cpts -eq 0 ]; then
+    echo "No SimPoint checkpoints for $gap_exe, see $CPT_DIR/err"
+    exit 1
+fi
+echo "$gap_exe: $num_cpts simpoints"
+# --------------------------------------------------------------- #
+# Simulate every (configuration, SimPoint) pair, JOBS at a time
+result_dirs=()
+for sweep_config in "${sweep_configs[@]}"; do
+    name=${sweep_config%%|*}
+    config_opts=${sweep_config#*|}
+    result_dirs+=($SP_DIR/$name)
+
+    for cpt in $(seq 1 $num_cpts); do
+        OUT_DIR=$SP_DIR/$name/sp$cpt
+        mkdir -p $OUT_DIR
+        $GEM5 --outdir=$OUT_DIR \
+        $CONFIG_FILE \
+        --num-cpus=1 --mem-size=4GB \
+        --caches --l2cache --cpu-type=DerivO3CPU \
+        $STT_OPTS $config_opts \
+        --restore-simpoint-checkpoint -r $cpt --checkpoint-dir=$CPT_DIR \
+        -c $EXE_PATH \
+        -o "-g $GRAPHSIZE -n $ITERS" 1>$OUT_DIR/out 2>$OUT_DIR/err&
+
+        while [ $(jobs -r | wc -l) -ge $JOBS ]; do
+            wait -n
+        done
+    done
+done
+wait
+# --------------------------------------------------------------- #
+
+python3 $STT_PATH/sample_scripts/simpoint_ipc.py $CPT_DIR "${result_dirs[@]}"
@@ -0,0 +1,63 @@
+import argparse
+import os
+import re
+
+# Combine the per-SimPoint runs of one configuration into a whole-program
+# estimate. Checkpoint N (in the order -r N restores them) is expected to
+# have been simulated into <results>/sp<N>. The weighted CPI is the
+# SimPoint estimate; the IPC reported is its inverse.
+
+CPT_RE = re.compile(r'cpt\.simpoint_(\d+)_inst_(\d+)'
+                    r'_weight_([\d\.e\-]+)_interval_(\d+)_warmup_(\d+)')
+IPC_RE = re.compile(r'^system\.switch_cpus\d*\.ipc\s+([\d\.e\-]+|nan|inf)',
+                    re.MULTILINE)
+DUMP_SEP = '---------- Begin Simulation Statistics ----------'
+
+
+def interval_ipc(stats_path):
+    with open(stats_path) as f:
+        # The last dump covers the measured interval, after warmup
+        dump = f.read().split(DUMP_SEP)[-1]
+    values = [float(v) for v in IPC_RE.findall(dump)]
+    if not values:
+        return None
+    return sum(values) / len(values)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Weighted IPC over SimPoint runs')
+    parser.add_argument('cpt_dir', help='directory of the SimPoint checkpoints')
+    parser.add_argument('results', nargs='+',
+                        help='result directories, one per configuration')
+    args = parser.parse_args()
+
+    cpts = sorted(d for d in os.listdir(args.cpt_dir) if CPT_RE.match(d))
+    if not cpts:
+        raise SystemExit(f'no SimPoint checkpoints in {args.cpt_dir}')
+    weights = [float(CPT_RE.match(d).group(3)) for d in cpts]
+
+    for results in args.results:
+        cpi = 0.0
+        covered = 0.0
+        missing = []
+        for num, weight in enumerate(weights, 1):
+            stats = os.path.join(results, f'sp{num}', 'stats.txt')
+            ipc = interval_ipc(stats) if os.path.exists(stats) else None
+            if not ipc:
+                missing.append(num)
+                continue
+            cpi += weight / ipc
+            covered += weight
+        if covered == 0:
+            print(f'{results}: no results')
+            continue
+        # Renormalize over the SimPoints that finished
+        cpi /= covered
+        print(f'{results}: weighted IPC {1 / cpi:.4f}, CPI {cpi:.4f}, '
+              f'coverage {covered:.3f}'
+              + (f', missing simpoints {missing}' if missing else ''))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,127 @@
+import argparse
+import gzip
+
+import numpy as np
+
+# Pick representative intervals from the basic block vectors written by
+# --simpoint-profile, the way SimPoint 3.2 does: random projection,
+# k-means for a range of k, and the smallest k whose BIC score is close to
+# the best one. The output files have the SimPoint 3.2 format expected by
+# --take-simpoint-checkpoints.
+
+
+def read_bbv(path):
+    opener = gzip.open if path.endswith('.gz') else open
+    rows = []
+    with opener(path, 'rt') as f:
+        for line in f:
+            if not line.startswith('T'):
+                continue
+            row = {}
+            for token in line[1:].split():
+                _, bb, count = token.split(':')
+                row[int(bb)] = int(count)
+            rows.append(row)
+    if not rows:
+        raise SystemExit(f'no intervals in {path}')
+
+    num_bbs = max(max(row) for row in rows if row) + 1
+    bbv = np.zeros((len(rows), num_bbs))
+    for i, row in enumerate(rows):
+        for bb, count in row.items():
+            bbv[i, bb] = count
+    # Intervals are compared by where they spend their time, not how long
+    # they are, so normalize each vector
+    return bbv / np.maximum(bbv.sum(axis=1, keepdims=True), 1)
+
+
+def kmeans(data, k, rng, iters):
+    # k-means++ seeding
+    centers = [data[rng.integers(len(data))]]
+    for _ in range(1, k):
+        dist = np.min([((data - c) ** 2).sum(axis=1) for c in centers], axis=0)
+        if dist.sum() == 0:
+            break
+        centers.append(data[rng.choice(len(data), p=dist / dist.sum())])
+    centers = np.array(centers)
+
+    for _ in range(iters):
+        dist = ((data[:, None, :] - centers[None, :, :]) ** 2).sum(axis=2)
+        labels = dist.argmin(axis=1)
+        new_centers = np.array([
+            data[labels == c].mean(axis=0) if (labels == c).any()
+            else centers[c] for c in range(len(centers))
+        ])
+        if np.allclose(new_centers, centers):
+            break
+        centers = new_centers
+    dist = ((data[:, None, :] - centers[None, :, :]) ** 2).sum(axis=2)
+    return centers, dist.argmin(axis=1), dist
+
+
+def bic(data, centers, labels, dist):
+    # Spherical Gaussian BIC, as in X-means and SimPoint
+    n, d = data.shape
+    k = len(centers)
+    if n <= k:
+        return -np.inf
+    variance = dist[np.arange(n), labels].sum() / ((n - k) * d)
+    if variance <= 0:
+        return np.inf
+    loglike = 0.0
+    for c in range(k):
+        size = (labels == c).sum()
+        if size == 0:
+            continue
+        loglike += (size * np.log(size) - size * np.log(n)
+                    - size / 2 * np.log(2 * np.pi)
+                    - size * d / 2 * np.log(variance)
+                    - (size - k) / 2)
+    params = (k - 1) + d * k + 1
+    return loglike - params / 2 * np.log(n)
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Pick SimPoints from a gem5 BBV profile')
+    parser.add_argument('bbv', help='simpoint.bb.gz from --simpoint-profile')
+    parser.add_argument('simpoints', help='output simpoint file')
+    parser.add_argument('weights', help='output weight file')
+    parser.add_argument('--max-k', type=int, default=30)
+    parser.add_argument('--dim', type=int, default=15,
+                        help='dimensions to project the BBVs to')
+    parser.add_argument('--bic-threshold', type=float, default=0.9)
+    parser.add_argument('--iters', type=int, default=100)
+    parser.add_argument('--seed', type=int, default=493575226)
+    args = parser.parse_args()
+
+    rng = np.random.default_rng(args.seed)
+    bbv = read_bbv(args.bbv)
+    projection = rng.uniform(-1, 1, size=(bbv.shape[1], args.dim))
+    data = bbv @ projection
+
+    runs = []
+    for k in range(1, min(args.max_k, len(data)) + 1):
+        centers, labels, dist = kmeans(data, k, rng, args.iters)
+        runs.append((bic(data, centers, labels, dist), centers, labels, dist))
+
+    scores = [run[0] for run in runs]
+    lo, hi = min(scores), max(scores)
+    for score, centers, labels, dist in runs:
+        if hi == lo or (score - lo) >= args.bic_threshold * (hi - lo):
+            break
+    print(f'{len(data)} intervals, {len(centers)} simpoints')
+
+    with open(args.simpoints, 'w') as sp, open(args.weights, 'w') as wt:
+        for c in range(len(centers)):
+            members = np.flatnonzero(labels == c)
+            if len(members) == 0:
+                continue
+            # the interval closest to the centroid represents its cluster
+            interval = members[dist[members, c].argmin()]
+            sp.write(f'{interval} {c}\n')
+            wt.write(f'{len(members) / len(data):.6f} {c}\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,165 @@
+import argparse
+import csv
+import gzip
+import re
+import struct
+import sys
+
+# Reader for the binary stats written by --stats-file=bin://stats.bin
+# (src/base/stats/binary.hh). A file holds one or more schemas, each
+# followed by the rows of the dumps that had those columns. records()
+# streams them one record at a time, so a long run with many dumps is
+# never held in memory; read() collects them as Segments. As a script it
+# prints the selected stats, one row per dump:
+#   stats_bin.py m5out/stats.bin -s 'switch_cpus.ipc' -s 'l2.*miss_rate'
+#   stats_bin.py m5out/stats.bin --list
+#   stats_bin.py m5out/stats.bin --csv > stats.csv
+#
+# Rows are stored row-major, one record per dump, because the simulator
+# appends a dump as soon as it is taken without knowing how many will
+# follow, and a run that is killed leaves every complete row readable.
+# Rows of a schema have a fixed width, so one stat of every dump can
+# still be read by seeking with a stride of the row size.
+
+MAGIC = b'gem5stat'
+VERSION = 1
+
+
+class Segment:
+    """The dumps written with one schema"""
+
+    def __init__(self, names, descs, order):
+        self.names = names
+        self.descs = descs
+        self.rows = []
+        self.index = {name: i for i, name in enumerate(names)}
+        # unpacks one row record
+        self.row = struct.Struct(f'{order}{len(names)}d')
+
+    def column(self, name):
+        i = self.index[name]
+        return [row[i] for row in self.rows]
+
+    def select(self, patterns):
+        """The names matching any of the regular expressions"""
+        if not patterns:
+            return list(self.names)
+        regexes = [re.compile(p) for p in patterns]
+        return [n for n in self.names if any(r.search(n) for r in regexes)]
+
+
+def records(f, path, rows=True):
+    """Yields each schema as a new Segment and each row as a tuple, in
+    file order, reading one record at a time from the binary file f.
+    With rows=False the rows are skipped and only schemas are yielded."""
+    header = f.read(16)
+    if header[:8] != MAGIC:
+        raise SystemExit(f'{path}: not a gem5 binary stats file')
+    # the byte order mark tells how the simulator host stored integers
+    for order in '<>':
+        version, mark = struct.unpack_from(order + 'II', header, 8)
+        if mark == 0x01020304:
+            break
+    else:
+        raise SystemExit(f'{path}: bad byte order mark')
+    if version != VERSION:
+        raise SystemExit(f'{path}: version {version}, expected {VERSION}')
+
+    u32 = struct.Struct(order + 'I')
+    record = struct.Struct(order + 'cI')
+
+    def string():
+        (n,) = u32.unpack(f.read(4))
+        return f.read(n).decode()
+
+    segment = None
+    pos = 16
+    while True:
+        head = f.read(record.size)
+        if len(head) < record.size:
+            # end of file, or the simulator stopped in the middle of a dump
+            return
+        kind, ncols = record.unpack(head)
+        if kind == b'S':
+            names, descs = [], []
+            for _ in range(ncols):
+                names.append(string())
+                descs.append(string())
+            segment = Segment(names, descs, order)
+            yield segment
+        elif kind == b'R':
+            if not segment or ncols != len(segment.names):
+                raise SystemExit(f'{path}: row without a matching schema')
+            if not rows:
+                f.seek(segment.row.size, 1)
+                continue
+            data = f.read(segment.row.size)
+            if len(data) < segment.row.size:
+                return
+            yield segment.row.unpack(data)
+        else:
+            raise SystemExit(f'{path}: bad record at offset {pos}')
+        pos = f.tell()
+
+
+def open_stats(path):
+    opener = gzip.open if path.endswith('.gz') else open
+    return opener(path, 'rb')
+
+
+def read(path):
+    """All the Segments of a file, with their rows"""
+    segments = []
+    with open_stats(path) as f:
+        for rec in records(f, path):
+            if isinstance(rec, Segment):
+                segments.append(rec)
+            else:
+                segments[-1].rows.append(rec)
+    return segments
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description='Print stats from a gem5 binary stats file')
+    parser.add_argument('stats', help='stats.bin or stats.bin.gz')
+    parser.add_argument('-s', '--stat', action='append', default=[],
+                        help='regular expression of the stats to print, '
+                             'can be repeated (default: all)')
+    parser.add_argument('--list', action='store_true',
+                        help='list the stats and their descriptions')
+    parser.add_argument('--csv', action='store_true',
+                        help='print comma separated values')
+    args = parser.parse_args()
+
+    with open_stats(args.stats) as f:
+        if args.list:
+            seen = set()
+            for seg in records(f, args.stats, rows=False):
+                selected = set(seg.select(args.stat))
+                for name, desc in zip(seg.names, seg.descs):
+                    if name not in seen and name in selected:
+                        seen.add(name)
+                        print(f'{name:60s} {desc}')
+            return
+
+        writer = csv.writer(sys.stdout) if args.csv else None
+        dump = 0
+        for rec in records(f, args.stats):
+            if isinstance(rec, Segment):
+                names = rec.select(args.stat)
+                cols = [rec.index[n] for n in names]
+                if writer:
+                    writer.writerow(['dump'] + names)
+            elif writer:
+                writer.writerow([dump] + [rec[i] for i in cols])
+                dump += 1
+            else:
+                print(f'---------- dump {dump} ----------')
+                for name, i in zip(names, cols):
+                    print(f'{name:60s} {rec[i]:.6g}')
+                dump += 1
+
+
+if __name__ == '__main__':
+    main()
@@ -56,6 +56,7 @@
 #include "mem/request.hh"
 #include "sim/full_system.hh"
 #include "sim/process.hh"
+#include "sim/system.hh"
 
 namespace X86ISA {
 
@@ -368,6 +369,12 @@ TLB::translate(RequestPtr req, ThreadContext *tc, Translation *translation,
                     assert(entry);
                 } else {
                     Process *p = tc->getProcessPtr();
+                    // growing the stack allocates from the shared page
+                    // table, serialize with the other event queues; the
+                    // caches of this core are between accesses, see
+                    // mem/eventq_bridge.hh
+                    EventQueue::ScopedMigration migrate(
+                        p->system->eventQueue(), inParallelMode);
                     const EmulationPageTable::Entry *pte =
                         p->pTable->lookup(vaddr);
                     if (!pte && mode != Execute) {
@@ -477,6 +477,7 @@ registerHandlers(Handler reset_handler, Handler dump_handler)
 
 CallbackQueue dumpQueue;
 CallbackQueue resetQueue;
+CallbackQueue sampleQueue;
 
 void
 processResetQueue()
@@ -490,6 +491,12 @@ processDumpQueue()
     dumpQueue.process();
 }
 
+void
+processSampleQueue()
+{
+    sampleQueue.process();
+}
+
 void
 registerResetCallback(Callback *cb)
 {
@@ -537,6 +544,12 @@ registerDumpCallback(Callback *cb)
     dumpQueue.add(cb);
 }
 
+void
+registerSampleCallback(Callback *cb)
+{
+    sampleQueue.add(cb);
+}
+
 } // namespace Stats
 
 void
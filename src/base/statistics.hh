@@ -3253,6 +3253,13 @@ void registerResetCallback(Callback *cb);
  */
 void registerDumpCallback(Callback *cb);
 
+/**
+ * Register a callback that should be called whenever statistics are
+ * about to be sampled outside a dump, to bring stats that are only
+ * updated lazily up to date (see StatSampler)
+ */
+void registerSampleCallback(Callback *cb);
+
 /**
  * Process all the callbacks in the reset callbacks queue
  */
@@ -3263,6 +3270,11 @@ void processResetQueue();
  */
 void processDumpQueue();
 
+/**
+ * Process all the callbacks in the sample callbacks queue
+ */
+void processSampleQueue();
+
 std::list<Info *> &statsList();
 
 typedef std::map<const void *, Info *> MapType;
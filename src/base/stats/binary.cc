@@ -0,0 +1,388 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "base/stats/binary.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+#include "base/logging.hh"
+#include "base/stats/info.hh"
+
+namespace Stats {
+
+void
+BinaryWriter::open(std::ostream &_stream)
+{
+    if (stream)
+        panic("stream already set!");
+
+    stream = &_stream;
+    if (!valid())
+        fatal("Unable to open output stream for writing\n");
+
+    const uint32_t header[] = { version, 0x01020304 };
+    stream->write("gem5stat", 8);
+    stream->write((const char *)header, sizeof(header));
+}
+
+bool
+BinaryWriter::valid() const
+{
+    return stream != nullptr && stream->good();
+}
+
+void
+BinaryWriter::writeString(const std::string &str)
+{
+    uint32_t len = str.size();
+    stream->write((const char *)&len, sizeof(len));
+    stream->write(str.data(), len);
+}
+
+void
+BinaryWriter::writeSchema(const std::vector<std::string> &names,
+                          const std::vector<std::string> &descs)
+{
+    assert(names.size() == descs.size());
+
+    uint32_t ncols = names.size();
+    stream->put('S');
+    stream->write((const char *)&ncols, sizeof(ncols));
+    for (uint32_t i = 0; i < ncols; ++i) {
+        writeString(names[i]);
+        writeString(descs[i]);
+    }
+}
+
+void
+BinaryWriter::writeRow(const Result *values, uint32_t ncols)
+{
+    stream->put('R');
+    stream->write((const char *)&ncols, sizeof(ncols));
+    stream->write((const char *)values, ncols * sizeof(Result));
+}
+
+void
+BinaryWriter::flush()
+{
+    stream->flush();
+}
+
+Binary::Binary()
+    : names(nullptr), descs(nullptr), descriptions(false)
+{
+}
+
+void
+Binary::open(std::ostream &stream)
+{
+    writer.open(stream);
+}
+
+bool
+Binary::valid() const
+{
+    return writer.valid();
+}
+
+void
+Binary::begin()
+{
+    row.clear();
+    shape.clear();
+}
+
+void
+Binary::end()
+{
+    if (shape != schemaShape) {
+        // name the columns by visiting the same stats again, which is
+        // only needed for the first dump or when a stat changes size
+        std::vector<std::string> new_names, new_descs;
+        std::vector<std::pair<Info *, size_t>> stats;
+        stats.swap(shape);
+        row.clear();
+
+        names = &new_names;
+        descs = &new_descs;
+        for (auto &stat : stats)
+            stat.first->visit(*this);
+        names = descs = nullptr;
+
+        writer.writeSchema(new_names, new_descs);
+        schemaShape = shape;
+    }
+
+    writer.writeRow(row);
+    writer.flush();
+}
+
+bool
+Binary::noOutput(const Info &info)
+{
+    // unlike the text output, zero stats and stats with a zero prereq
+    // keep their columns so that the schema stays the same
+    return !info.flags.isSet(display);
+}
+
+void
+Binary::add(const std::string &name, const std::string &desc, Result value)
+{
+    row.push_back(value);
+    if (names) {
+        names->push_back(name);
+        descs->push_back(descriptions ? desc : std::string());
+    }
+}
+
+void
+Binary::endStat(const Info &info, size_t first)
+{
+    shape.emplace_back(const_cast<Info *>(&info), row.size() - first);
+}
+
+void
+Binary::addVector(const Info &info, const std::string &name,
+                  const std::string &desc,
+                  const std::vector<std::string> &subnames,
+                  const std::vector<std::string> &subdescs,
+                  const VResult &vec, Result total, bool force_subnames)
+{
+    // the columns are named the way the text output names the lines,
+    // and only when a schema is written
+    std::string base = names ? name + info.separatorString : "";
+    bool havesub = false;
+    for (auto &subname : subnames)
+        havesub = havesub || !subname.empty();
+
+    if (vec.size() == 1) {
+        std::string col;
+        if (names) {
+            col = !force_subnames ? name :
+                base + (havesub ? subnames[0] : std::to_string(0));
+        }
+        add(col, desc, vec[0]);
+    } else {
+        for (off_type i = 0; i < vec.size(); ++i) {
+            if (havesub && (i >= subnames.size() || subnames[i].empty()))
+                continue;
+
+            std::string col;
+            if (names)
+                col = base + (havesub ? subnames[i] : std::to_string(i));
+            bool subdesc = i < subdescs.size() && !subdescs[i].empty();
+            add(col, subdesc ? subdescs[i] : desc, vec[i]);
+        }
+    }
+
+    if (info.flags.isSet(::Stats::total))
+        add(base + "total", desc, total);
+}
+
+void
+Binary::addDist(const Info &info, const std::string &name,
+                const std::string &desc, const DistData &data)
+{
+    std::string base = names ? name + info.separatorString : "";
+
+    add(base + "samples", desc, data.samples);
+    add(base + "mean", desc,
+        data.samples ? data.sum / data.samples : NAN);
+    if (data.type == Hist) {
+        add(base + "gmean", desc,
+            data.samples ? exp(data.logs / data.samples) : NAN);
+    }
+
+    Result stdev = NAN;
+    if (data.samples)
+        stdev = sqrt((data.samples * data.squares - data.sum * data.sum) /
+                     (data.samples * (data.samples - 1.0)));
+    add(base + "stdev", desc, stdev);
+
+    if (data.type == Deviation)
+        return;
+
+    Result total = 0.0;
+    if (data.type == Dist) {
+        add(base + "underflows", desc, data.underflow);
+        total += data.underflow;
+    }
+
+    for (off_type i = 0; i < data.cvec.size(); ++i) {
+        std::string bucket;
+        if (names) {
+            Counter low = i * data.bucket_size + data.min;
+            Counter high = std::min(low + data.bucket_size - 1.0, data.max);
+            bucket = base + std::to_string((long long)low);
+            if (low < high)
+                bucket += "-" + std::to_string((long long)high);
+        }
+        add(bucket, desc, data.cvec[i]);
+        total += data.cvec[i];
+    }
+
+    if (data.type == Dist) {
+        add(base + "overflows", desc, data.overflow);
+        total += data.overflow;
+        add(base + "min_value", desc, data.min_val);
+        add(base + "max_value", desc, data.max_val);
+    }
+
+    add(base + "total", desc, total);
+}
+
+void
+Binary::visit(const ScalarInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    size_t first = row.size();
+    add(info.name, info.desc, info.result());
+    endStat(info, first);
+}
+
+void
+Binary::visit(const VectorInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    size_t first = row.size();
+    addVector(info, info.name, info.desc, info.subnames, info.subdescs,
+              info.result(), info.total(), false);
+    endStat(info, first);
+}
+
+void
+Binary::visit(const Vector2dInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    size_t first = row.size();
+
+    bool havesub = false;
+    for (auto &subname : info.subnames)
+        havesub = havesub || !subname.empty();
+
+    for (off_type i = 0; i < info.x; ++i) {
+        if (havesub && (i >= info.subnames.size() || info.subnames[i].empty()))
+            continue;
+
+        VResult yvec(info.y);
+        Result total = 0.0;
+        for (off_type j = 0; j < info.y; ++j) {
+            yvec[j] = info.cvec[i * info.y + j];
+            total += yvec[j];
+        }
+
+        std::string name;
+        if (names) {
+            name = info.name + "_" +
+                (havesub ? info.subnames[i] : std::to_string(i));
+        }
+        // the total of every row is left to the stat total below
+        addVector(info, name, info.desc, info.y_subnames,
+                  std::vector<std::string>(), yvec, total, true);
+    }
+
+    if (info.flags.isSet(::Stats::total) && info.x > 1)
+        add(info.name + info.separatorString + "total", info.desc,
+            info.total());
+
+    endStat(info, first);
+}
+
+void
+Binary::visit(const DistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    size_t first = row.size();
+    addDist(info, info.name, info.desc, info.data);
+    endStat(info, first);
+}
+
+void
+Binary::visit(const VectorDistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    size_t first = row.size();
+    for (off_type i = 0; i < info.size(); ++i) {
+        std::string name;
+        if (names) {
+            name = info.name + "_" + (info.subnames[i].empty() ?
+                                      std::to_string(i) : info.subnames[i]);
+        }
+        const std::string &desc =
+            info.subdescs[i].empty() ? info.desc : info.subdescs[i];
+        addDist(info, name, desc, info.data[i]);
+    }
+    endStat(info, first);
+}
+
+void
+Binary::visit(const FormulaInfo &info)
+{
+    visit((const VectorInfo &)info);
+}
+
+void
+Binary::visit(const SparseHistInfo &info)
+{
+    if (noOutput(info))
+        return;
+
+    size_t first = row.size();
+    add(info.name + info.separatorString + "samples", info.desc,
+        info.data.samples);
+    endStat(info, first);
+}
+
+Output *
+initBinary(const std::string &filename, bool desc)
+{
+    static Binary binary;
+    static bool connected = false;
+
+    if (!connected) {
+        binary.open(*simout.findOrCreate(filename, true)->stream());
+        binary.descriptions = desc;
+        connected = true;
+    }
+
+    return &binary;
+}
+
+} // namespace Stats
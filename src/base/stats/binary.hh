@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __BASE_STATS_BINARY_HH__
+#define __BASE_STATS_BINARY_HH__
+
+#include <iosfwd>
+#include <string>
+#include <vector>
+
+#include "base/stats/output.hh"
+#include "base/stats/types.hh"
+#include "base/output.hh"
+
+namespace Stats {
+
+class Info;
+struct DistData;
+
+/**
+ * Writer for the binary stats format. A file is a header followed by
+ * records. A schema record names the columns; every row record after it
+ * holds one value per column, so the rows of a schema have a fixed width
+ * and a column can be read with a strided seek. A new schema record is
+ * only written when the set of columns changes. Rows are row-major so
+ * that each dump is appended as it is taken, without knowing how many
+ * follow, and a run that stops early leaves every complete row readable.
+ *
+ *   header:  "gem5stat" uint32 version uint32 0x01020304 (byte order)
+ *   schema:  'S' uint32 ncols, ncols x (uint32 len, name,
+ *                                        uint32 len, desc)
+ *   row:     'R' uint32 ncols, ncols x float64
+ *
+ * All integers and values are in host byte order.
+ * sample_scripts/stats_bin.py reads these files.
+ */
+class BinaryWriter
+{
+  public:
+    static const uint32_t version = 1;
+
+    BinaryWriter() : stream(nullptr) {}
+
+    void open(std::ostream &stream);
+
+    bool valid() const;
+
+    void writeSchema(const std::vector<std::string> &names,
+                     const std::vector<std::string> &descs);
+
+    void writeRow(const Result *values, uint32_t ncols);
+
+    void writeRow(const std::vector<Result> &values)
+    { writeRow(values.data(), values.size()); }
+
+    void flush();
+
+  private:
+    void writeString(const std::string &str);
+
+    std::ostream *stream;
+};
+
+/**
+ * Stats output to the binary format, one column per displayed stat value
+ * and one row per dump. The columns cover every stat whatever its value,
+ * rather than skipping the zero ones like the text output does, so that
+ * consecutive dumps share a schema. Sparse histograms only contribute
+ * their sample count, as their buckets come and go.
+ */
+class Binary : public Output
+{
+  protected:
+    BinaryWriter writer;
+
+    /** The values of the dump in progress */
+    std::vector<Result> row;
+
+    /** The stats in the dump in progress and the columns of each */
+    std::vector<std::pair<Info *, size_t>> shape;
+
+    /** The shape of the last schema written */
+    std::vector<std::pair<Info *, size_t>> schemaShape;
+
+    /**
+     * Set while the stats are visited again to name the columns of a
+     * new schema
+     */
+    std::vector<std::string> *names;
+    std::vector<std::string> *descs;
+
+    bool noOutput(const Info &info);
+
+    /**
+     * Add a column to the dump in progress. The names and descriptions
+     * are only looked at while naming the columns of a new schema.
+     */
+    void add(const std::string &name, const std::string &desc,
+             Result value);
+    void addVector(const Info &info, const std::string &name,
+                   const std::string &desc,
+                   const std::vector<std::string> &subnames,
+                   const std::vector<std::string> &subdescs,
+                   const VResult &vec, Result total, bool force_subnames);
+    void addDist(const Info &info, const std::string &name,
+                 const std::string &desc, const DistData &data);
+
+    /** Close the columns of one stat */
+    void endStat(const Info &info, size_t first);
+
+  public:
+    bool descriptions;
+
+  public:
+    Binary();
+
+    void open(std::ostream &stream);
+
+    // Implement Visit
+    void visit(const ScalarInfo &info) override;
+    void visit(const VectorInfo &info) override;
+    void visit(const DistInfo &info) override;
+    void visit(const VectorDistInfo &info) override;
+    void visit(const Vector2dInfo &info) override;
+    void visit(const FormulaInfo &info) override;
+    void visit(const SparseHistInfo &info) override;
+
+    // Implement Output
+    bool valid() const override;
+    void begin() override;
+    void end() override;
+};
+
+Output *initBinary(const std::string &filename, bool desc);
+
+} // namespace Stats
+
+#endif // __BASE_STATS_BINARY_HH__
@@ -51,6 +51,7 @@
 #include <deque>
 #include <list>
 #include <string>
+#include <vector>
 
 #include "arch/generic/tlb.hh"
 #include "arch/utility.hh"
@@ -183,6 +184,7 @@ class BaseDynInst : public ExecContext, public RefCounted
         HasExplicitFlow,
         HasImplicitFlow,
         HasPendingSquash,   // for branch/load, if a squash is postponed due to the tainted dependent operands
+        TaintStalled,       // held back by tainted arguments since taintStallCycle
         // Akk[DOPP]: flags for DOPP
         IsDOPPLoadExecuting, 
         IsDOPPLoadSuccess,
@@ -192,6 +194,9 @@ class BaseDynInst : public ExecContext, public RefCounted
         // Akk[DOPP2]: represents whether the doppelganger load has finished and should wake dependents
         DOPPShouldWakeDependents,
         DOPPHasWokenDependents, // set if the doppelganger load has woken up dependents
+        HasDOPPAddrPred,    // the address predictor made a prediction at dispatch
+        DOPPPredCorrect,    // the predicted address matched the real one
+        TrainDeferred,      // [STT] the prefetcher trains on it at commit
         MaxFlags
     };
 
@@ -267,7 +272,7 @@ class BaseDynInst : public ExecContext, public RefCounted
     Addr physEffAddrHigh;
 
     /** The memory request flags (from translation). */
-    unsigned memReqFlags;
+    Request::FlagsType memReqFlags;
 
     /** data address space ID, for loads & stores. */
     short asid;
@@ -281,6 +286,12 @@ class BaseDynInst : public ExecContext, public RefCounted
     // Akk[DOPP] Pointer to the data for the doppelganger load memory access
     uint8_t *doppMemData = nullptr;
 
+    // Akk[DOPP] Address predicted at dispatch for the doppelganger load
+    Addr doppPredAddr;
+
+    // [STT] Cycle the instruction was first held back by taint
+    Cycles taintStallCycle;
+
     /** Pointer to the data for the validation result. */
     uint8_t *vldData;
 
@@ -290,6 +301,9 @@ class BaseDynInst : public ExecContext, public RefCounted
     /** Store queue index. */
     int16_t sqIdx;
 
+    /** [STT] ROB slot, used by the bit-vector taint engine. */
+    int16_t robIdx;
+
     /*** [Jiyong,STT] ***/
     /** Pointer to the data forwarded from store **/
     uint8_t *stFwdData;
@@ -350,6 +364,10 @@ class BaseDynInst : public ExecContext, public RefCounted
     /*** [Jiyong,STT] the producer of arguments(-1 for none) ***/
     std::array<DynInstPtr, TheISA::MaxInstSrcRegs> argProducers;
 
+    /*** [STT] younger ROB instructions that name this one as an argProducer,
+     *   used by the incremental taint engine to find what to re-evaluate ***/
+    std::vector<DynInstPtr> argConsumers;
+
 
   public:
     /** Records changes to result? */
@@ -412,6 +430,19 @@ class BaseDynInst : public ExecContext, public RefCounted
     bool hasPendingSquash() const { return instFlags[HasPendingSquash]; }
     void hasPendingSquash(bool f) { instFlags[HasPendingSquash] = f; }
 
+    /*** [STT] start of the delay caused by tainted arguments, kept from
+     *   the first time the instruction is held back until it is
+     *   untainted ***/
+    bool isTaintStalled() const { return instFlags[TaintStalled]; }
+    void taintStall(Cycles now)
+    {
+        if (!instFlags[TaintStalled]) {
+            instFlags[TaintStalled] = true;
+            taintStallCycle = now;
+        }
+    }
+    void clearTaintStall() { instFlags[TaintStalled] = false; }
+
     bool notAnInst() const { return instFlags[NotAnInst]; }
     void setNotAnInst() { instFlags[NotAnInst] = true; }
 
@@ -431,7 +462,14 @@ class BaseDynInst : public ExecContext, public RefCounted
     bool getDOPPDbg() const { return instFlags[DOPPDbg]; }
     void setDOPPDbg(bool f) { instFlags[DOPPDbg] = f; }
 
-    bool isDOPPPredCorrect() const { return false; }
+    bool hasDOPPAddrPred() const { return instFlags[HasDOPPAddrPred]; }
+    void hasDOPPAddrPred(bool f) { instFlags[HasDOPPAddrPred] = f; }
+
+    bool isDOPPPredCorrect() const { return instFlags[DOPPPredCorrect]; }
+    void isDOPPPredCorrect(bool f) { instFlags[DOPPPredCorrect] = f; }
+
+    bool isTrainDeferred() const { return instFlags[TrainDeferred]; }
+    void isTrainDeferred(bool f) { instFlags[TrainDeferred] = f; }
 
     void resetDOPP(){
         // call before doing the actual load after DOPP 
@@ -612,6 +650,21 @@ class BaseDynInst : public ExecContext, public RefCounted
         argProducers[idx] = inst;
     }
 
+    /*** [STT] functions related to argConsumers ***/
+    const std::vector<DynInstPtr> &getArgConsumers() const
+    {
+        return argConsumers;
+    }
+
+    void addArgConsumer(DynInstPtr &inst)
+    {
+        // an instruction may read the same producer through several sources
+        if (argConsumers.empty() || argConsumers.back() != inst)
+            argConsumers.push_back(inst);
+    }
+
+    void clearArgConsumers() { argConsumers.clear(); }
+
   private:
     /** Function to initialize variables in the constructors. */
     void initVars();
@@ -882,6 +935,10 @@ class BaseDynInst : public ExecContext, public RefCounted
     /** Marks a specific register as ready. */
     void markSrcRegReady(RegIndex src_idx);
 
+    /** Akk[DOPP2] Marks a ready source register as waiting again, for a
+     *  producer that is replayed. */
+    void markSrcRegNotReady(RegIndex src_idx);
+
     /** Returns if a source register is ready. */
     bool isReadySrcRegIdx(int idx) const
     {
@@ -976,6 +1033,9 @@ class BaseDynInst : public ExecContext, public RefCounted
     /** Returns whether or not this instruction has executed. */
     bool isExecuted() const { return status[Executed]; }
 
+    /** Clears this instruction as executed, so that it executes again. */
+    void clearExecuted() { status.reset(Executed); }
+
     /** Sets this instruction as ready to commit. */
     void setCanCommit() { status.set(CanCommit); }
 
@@ -1181,6 +1241,17 @@ BaseDynInst<Impl>::initiateMemRead(Addr addr, unsigned size,
         sreqLow = savedSreqLow;
         sreqHigh = savedSreqHigh;
     } else {
+        // Akk[DOPP]: the doppelganger goes to the predicted address, not
+        // to the one computed from its tainted operands
+        if (isDOPPLoadExecuting() && hasDOPPAddrPred())
+            addr = doppPredAddr;
+
+        // [STT] let the prefetchers tell speculative accesses apart
+        if (!isUnsquashable())
+            flags.set(Request::SQUASHABLE);
+        if (isDOPPLoadExecuting())
+            flags.set(Request::DOPPELGANGER);
+
         req = new Request(asid, addr, size, flags, masterId(), this->pc.instAddr(),
                           thread->contextId());
 
@@ -1193,7 +1264,18 @@ BaseDynInst<Impl>::initiateMemRead(Addr addr, unsigned size,
         if (TheISA::HasUnalignedMemAcc) {
             splitRequest(req, sreqLow, sreqHigh);
         }
+        // Akk[DOPP]: the real load verifies the predicted address
+        if (!isDOPPLoadExecuting() && isDOPPLoadSuccess()) {
+            isDOPPPredCorrect(hasDOPPAddrPred() && addr == doppPredAddr &&
+                              sreqLow == NULL);
+        }
+        // [STT] the access of a mispredicted doppelganger does not stand
+        // for the load, the one it makes now does
+        if (!isDOPPLoadExecuting() && !isDOPPPredCorrect())
+            isTrainDeferred(false);
         if (isDOPPPredCorrect() && isDOPPLoadSuccess()){
+            // same address, so reuse the doppelganger's translation
+            req->setPaddr(physEffAddrLow);
             translationStarted(true);
             translationCompleted(true);
         }
@@ -105,12 +105,15 @@ BaseDynInst<Impl>::initVars()
     /*** [Jiyong,STT] ***/
     instFlags[HasPendingSquash] = false;
     alreadyForwarded = false;
+    taintStallCycle = Cycles(0);
 
     // Akk[DOPP]
     DOPPAlreadyForwarded = false;
+    doppPredAddr = 0;
 
     lqIdx = -1;
     sqIdx = -1;
+    robIdx = -1;
 
     // Eventually make this a parameter.
     threadNumber = 0;
@@ -245,6 +248,16 @@ BaseDynInst<Impl>::markSrcRegReady(RegIndex src_idx)
     markSrcRegReady();
 }
 
+template <class Impl>
+void
+BaseDynInst<Impl>::markSrcRegNotReady(RegIndex src_idx)
+{
+    assert(readyRegs > 0);
+    _readySrcRegIdx[src_idx] = false;
+    --readyRegs;
+    clearCanIssue();
+}
+
 template <class Impl>
 bool
 BaseDynInst<Impl>::eaSrcsReady()
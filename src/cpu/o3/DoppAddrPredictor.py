@@ -0,0 +1,65 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.SimObject import SimObject
+from m5.params import *
+
+# Akk[DOPP]: address predictors for doppelganger loads. A tainted load
+# issues its doppelganger to the predicted address; the prediction is
+# verified once the real address is known.
+class DoppAddrPredictor(SimObject):
+    type = 'DoppAddrPredictor'
+    cxx_class = 'DoppAddrPredictor'
+    cxx_header = "cpu/o3/dopp_addr_pred.hh"
+    abstract = True
+
+    numThreads = Param.Unsigned(1, "Number of threads")
+    tableEntries = Param.Unsigned(1024, "Number of per-PC table entries")
+    confBits = Param.Unsigned(2, "Bits per confidence counter")
+    confThreshold = Param.Unsigned(2,
+        "Minimum confidence needed to make a prediction")
+    instShiftAmt = Param.Unsigned(2, "Number of bits to shift PCs by")
+
+class LastAddrDoppPredictor(DoppAddrPredictor):
+    type = 'LastAddrDoppPredictor'
+    cxx_class = 'LastAddrDoppPredictor'
+    cxx_header = "cpu/o3/dopp_addr_pred.hh"
+
+class StrideDoppPredictor(DoppAddrPredictor):
+    type = 'StrideDoppPredictor'
+    cxx_class = 'StrideDoppPredictor'
+    cxx_header = "cpu/o3/dopp_addr_pred.hh"
+
+class ContextDoppPredictor(DoppAddrPredictor):
+    type = 'ContextDoppPredictor'
+    cxx_class = 'ContextDoppPredictor'
+    cxx_header = "cpu/o3/dopp_addr_pred.hh"
+
+    historyLength = Param.Unsigned(2,
+        "Number of previous addresses of a load forming its context")
+    contextEntries = Param.Unsigned(4096,
+        "Number of entries in the context-indexed address table")
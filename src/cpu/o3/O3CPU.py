@@ -45,6 +45,7 @@ from BaseCPU import BaseCPU
 from FUPool import *
 from O3Checker import O3Checker
 from BranchPredictor import *
+from DoppAddrPredictor import *
 
 class DerivO3CPU(BaseCPU):
     type = 'DerivO3CPU'
@@ -63,6 +64,8 @@ class DerivO3CPU(BaseCPU):
         return True
 
     activity = Param.Unsigned(0, "Initial count")
+    gateQuiescentTick = Param.Bool(False, "Deschedule the tick while the "
+          "pipeline only waits on memory or FU completions")
 
     cacheStorePorts = Param.Unsigned(200, "Cache Ports. "
           "Constrains stores only. Loads are constrained by load FUs.")
@@ -170,9 +173,23 @@ class DerivO3CPU(BaseCPU):
     STT = Param.Bool(False, "Apply STT protection mechanism")
     # Akk: DOPP option
     DOPP = Param.Bool(False, "Apply DOPP optimization for STT protection")
+    doppAddrPred = Param.DoppAddrPredictor(NULL, "Doppelganger load address "
+                                           "predictor (NULL: use the "
+                                           "computed address)")
+    doppSelectiveReplay = Param.Bool(False, "Replay the dependents of a "
+                                     "doppelganger with a mispredicted "
+                                     "address instead of squashing")
+    doppPCStatsTopN = Param.Unsigned(20, "Number of PCs in the per-PC "
+                                     "doppelganger stats dump (0: off)")
+    sttPCStatsTopN = Param.Unsigned(20, "Number of PCs in the per-PC "
+                                    "taint delay stats dump (0: off)")
     implicitChannel = Param.Bool(False, "If handling implicit channel")
     ifPrintROB = Param.Bool(False, "If print all ROBs with DDIFT info")
     moreTransmitInsts = Param.Int(0, "More transmit instruction types")
+    taintEngine = Param.String('Full', "STT taint propagation engine "
+                               "(Full, Incremental, BitVector)")
+    checkTaint = Param.Bool(False, "Cross-check the taint engine against "
+                            "a full ROB walk every cycle")
 
     def addCheckerCpu(self):
         if buildEnv['TARGET_ISA'] in ['arm']:
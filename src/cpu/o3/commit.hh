@@ -214,6 +214,15 @@ class DefaultCommit
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /**
+     * Is commit stuck behind a head instruction that is waiting on
+     * execution, with no squash, trap or ROB update pending?
+     */
+    bool isQuiescent();
+
+    /** Samples the commit stats for cycles that the CPU skipped. */
+    void skipCycles(Cycles cycles);
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
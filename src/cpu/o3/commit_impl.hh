@@ -469,6 +469,43 @@ DefaultCommit<Impl>::isDrained() const
         interrupt == NoFault;
 }
 
+template <class Impl>
+bool
+DefaultCommit<Impl>::isQuiescent()
+{
+    if (interrupt != NoFault)
+        return false;
+
+    for (auto tid : *activeThreads) {
+        if ((commitStatus[tid] != Running && commitStatus[tid] != Idle) ||
+            trapInFlight[tid] || trapSquash[tid] || tcSquash[tid] ||
+            changedROBNumEntries[tid]) {
+            return false;
+        }
+
+        if (checkEmptyROB[tid] && rob->isEmpty(tid) &&
+            !iewStage->hasStoresToWB(tid)) {
+            return false;
+        }
+
+        if (!rob->isQuiescent(tid) ||
+            (cpu->STT && rob->getResolvedPendingSquashInst(tid))) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class Impl>
+void
+DefaultCommit<Impl>::skipCycles(Cycles cycles)
+{
+    // ppCommitStall is not notified for the skipped cycles
+    numCommittedDist.sample(0, cycles);
+    rob->skipCycles(cycles);
+}
+
 template <class Impl>
 void
 DefaultCommit<Impl>::takeOverFrom()
@@ -694,6 +731,8 @@ DefaultCommit<Impl>::tick()
     if (activeThreads->empty())
         return;
 
+    rob->sampleOccupancy();
+
     list<ThreadID>::iterator threads = activeThreads->begin();
     list<ThreadID>::iterator end = activeThreads->end();
 
@@ -922,6 +961,7 @@ DefaultCommit<Impl>::commit()
                             ++stalledMemoryViolations;
                         }
                         fromIEW->instCausingSquash[tid]->hasPendingSquash(true);
+                        fromIEW->instCausingSquash[tid]->taintStall(cpu->curCycle());
                     } else {
                         handleSquashSignalFromIEW(tid);
                     }
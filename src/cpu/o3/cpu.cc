@@ -48,6 +48,7 @@
 
 #include "arch/generic/traits.hh"
 #include "arch/kernel_stats.hh"
+#include "base/callback.hh"
 #include "config/the_isa.hh"
 #include "cpu/activity.hh"
 #include "cpu/checker/cpu.hh"
@@ -338,6 +339,8 @@ FullO3CPU<Impl>::FullO3CPU(DerivO3CPUParams *params)
 
     // Setup the ROB for whichever stages need it.
     commit.setROB(&rob);
+    iew.instQueue.setROB(&rob);
+    iew.ldstQueue.setROB(&rob);
 
     lastActivatedCycle = 0;
 #if 0
@@ -457,8 +460,18 @@ FullO3CPU<Impl>::FullO3CPU(DerivO3CPUParams *params)
     if (DOPP){
         assert(STT);
     }
+    doppAddrPred = DOPP ? params->doppAddrPred : NULL;
+    doppSelectiveReplay = DOPP && params->doppSelectiveReplay;
+    cprintf("DOPP = %d, doppAddrPred = %s, doppSelectiveReplay = %d\n",
+            DOPP, doppAddrPred ? doppAddrPred->name() : "none",
+            doppSelectiveReplay);
 
     assert (moreTransmitInsts >= 0 && moreTransmitInsts <= 2);
+
+    gateQuiescentTick = params->gateQuiescentTick;
+    quiescentTicksToGate = params->backComSize + params->forwardComSize;
+    quiescentTicks = 0;
+    tickGated = false;
 }
 
 template <class Impl>
@@ -474,6 +487,8 @@ FullO3CPU<Impl>::regProbePoints()
 
     ppInstAccessComplete = new ProbePointArg<PacketPtr>(getProbeManager(), "InstAccessComplete");
     ppDataAccessComplete = new ProbePointArg<std::pair<DynInstPtr, PacketPtr> >(getProbeManager(), "DataAccessComplete");
+    ppCommittedLoadAccess = new ProbePointArg<PacketPtr>(getProbeManager(),
+                                                         "CommittedLoadAccess");
 
     fetch.regProbePoints();
     rename.regProbePoints();
@@ -506,6 +521,24 @@ FullO3CPU<Impl>::regStats()
               "for an interrupt")
         .prereq(quiesceCycles);
 
+    timesGated
+        .name(name() + ".timesGated")
+        .desc("Number of times that the tick was descheduled while the "
+              "pipeline was quiescent")
+        .prereq(timesGated);
+
+    gatedCycles
+        .name(name() + ".gatedCycles")
+        .desc("Total number of cycles skipped while the pipeline was "
+              "quiescent (also counted in numCycles)")
+        .prereq(gatedCycles);
+
+    // Skipped cycles are only accounted when the tick resumes
+    Stats::registerDumpCallback(new MakeCallback<FullO3CPU<Impl>,
+                                &FullO3CPU<Impl>::updateGatedCycles>(this));
+    Stats::registerSampleCallback(new MakeCallback<FullO3CPU<Impl>,
+                                  &FullO3CPU<Impl>::updateGatedCycles>(this));
+
     // Number of Instructions simulated
     // --------------------------------
     // Should probably be in Base CPU but need templated
@@ -604,6 +637,16 @@ FullO3CPU<Impl>::regStats()
         .prereq(miscRegfileWrites);
 }
 
+template <class Impl>
+void
+FullO3CPU<Impl>::resetStats()
+{
+    // Cycles skipped before the reset belong to the previous period
+    updateGatedCycles();
+
+    BaseO3CPU::resetStats();
+}
+
 template <class Impl>
 void
 FullO3CPU<Impl>::tick()
@@ -612,6 +655,12 @@ FullO3CPU<Impl>::tick()
     assert(!switchedOut());
     assert(drainState() != DrainState::Drained);
 
+    if (tickGated) {
+        updateGatedCycles();
+        tickGated = false;
+        quiescentTicks = 0;
+    }
+
     ++numCycles;
     updateCycleCounters(BaseCPU::CPU_STATE_ON);
 
@@ -639,6 +688,9 @@ FullO3CPU<Impl>::tick()
     activityRec.advance();
 
     DPRINTF(O3CPU, "activityRec.advance() complete\n");
+    quiescentTicks = gateQuiescentTick && isQuiescent() ?
+        quiescentTicks + 1 : 0;
+
     if (removeInstsThisCycle) {
         cleanUpRemovedInsts();
     }
@@ -652,6 +704,11 @@ FullO3CPU<Impl>::tick()
             DPRINTF(O3CPU, "Idle!\n");
             lastRunningCycle = curCycle();
             timesIdled++;
+        } else if (quiescentTicks > quiescentTicksToGate) {
+            DPRINTF(Activity, "Pipeline quiescent, gating the tick!\n");
+            lastRunningCycle = curCycle();
+            tickGated = true;
+            timesGated++;
         } else {
             schedule(tickEvent, clockEdge(Cycles(1)));
             DPRINTF(O3CPU, "Scheduling next tick!\n");
@@ -825,6 +882,8 @@ FullO3CPU<Impl>::suspendContext(ThreadID tid)
     // If this was the last thread then unschedule the tick event.
     if (activeThreads.size() == 0) {
         unscheduleTickEvent();
+        updateGatedCycles();
+        tickGated = false;
         lastRunningCycle = curCycle();
         _status = Idle;
     }
@@ -1207,6 +1266,44 @@ FullO3CPU<Impl>::isDrained() const
     return drained;
 }
 
+template <class Impl>
+bool
+FullO3CPU<Impl>::isQuiescent()
+{
+    if (FullSystem || numThreads != 1 || activeThreads.size() != 1 ||
+        drainState() != DrainState::Running || removeInstsThisCycle ||
+        checker) {
+        return false;
+    }
+
+    return fetch.isQuiescent() && decode.isQuiescent() &&
+        rename.isQuiescent() && iew.isQuiescent() && commit.isQuiescent();
+}
+
+template <class Impl>
+void
+FullO3CPU<Impl>::updateGatedCycles()
+{
+    // The cycle after lastRunningCycle is counted by the tick that resumes
+    if (!tickGated || curCycle() <= lastRunningCycle + Cycles(1))
+        return;
+
+    Cycles cycles(curCycle() - lastRunningCycle - Cycles(1));
+
+    DPRINTF(Activity, "Accounting %lu gated cycles\n", (uint64_t)cycles);
+
+    numCycles += cycles;
+    gatedCycles += cycles;
+
+    fetch.skipCycles(cycles);
+    decode.skipCycles(cycles);
+    rename.skipCycles(cycles);
+    iew.skipCycles(cycles);
+    commit.skipCycles(cycles);
+
+    lastRunningCycle += cycles;
+}
+
 template <class Impl>
 void
 FullO3CPU<Impl>::commitDrained(ThreadID tid)
@@ -1815,6 +1912,20 @@ template <class Impl>
 void
 FullO3CPU<Impl>::wakeCPU()
 {
+    // Whatever woke the CPU may only reach the stages through the time
+    // buffers, so restart the quiescence window
+    quiescentTicks = 0;
+
+    if (tickGated) {
+        // The skipped cycles are accounted by tick() once it resumes
+        if (!tickEvent.scheduled()) {
+            DPRINTF(Activity, "Waking up gated CPU\n");
+            schedule(tickEvent, clockEdge(Cycles(
+                curCycle() == lastRunningCycle ? 1 : 0)));
+        }
+        return;
+    }
+
     if (activityRec.active() || tickEvent.scheduled()) {
         DPRINTF(Activity, "CPU already running.\n");
         return;
@@ -62,6 +62,7 @@
 #include "cpu/base.hh"
 #include "cpu/o3/comm.hh"
 #include "cpu/o3/cpu_policy.hh"
+#include "cpu/o3/dopp_addr_pred.hh"
 #include "cpu/o3/scoreboard.hh"
 #include "cpu/o3/thread_state.hh"
 #include "cpu/simple_thread.hh"
@@ -247,6 +248,21 @@ class FullO3CPU : public BaseO3CPU
     /** Check if a system is in a drained state. */
     bool isDrained() const;
 
+    /**
+     * Check if ticking again would leave the pipeline as it is.
+     *
+     * Every stage has to be stalled on something that calls wakeCPU()
+     * when it is done (a memory response, an FU completion, a cache
+     * retry), and only count cycles while it waits.
+     */
+    bool isQuiescent();
+
+    /**
+     * Account for the cycles skipped since tick() gated itself, as if
+     * each of them had ticked the quiescent pipeline.
+     */
+    void updateGatedCycles();
+
   public:
     /** Constructs a CPU with the given parameters. */
     FullO3CPU(DerivO3CPUParams *params);
@@ -256,8 +272,12 @@ class FullO3CPU : public BaseO3CPU
     /** Registers statistics. */
     void regStats() override;
 
+    void resetStats() override;
+
     ProbePointArg<PacketPtr> *ppInstAccessComplete;
     ProbePointArg<std::pair<DynInstPtr, PacketPtr> > *ppDataAccessComplete;
+    /** [STT] Loads that accessed memory speculatively, at commit */
+    ProbePointArg<PacketPtr> *ppCommittedLoadAccess;
 
     /** Register probe points. */
     void regProbePoints() override;
@@ -687,6 +707,22 @@ class FullO3CPU : public BaseO3CPU
      */
     ActivityRecorder activityRec;
 
+    /** Whether tick() may deschedule itself while the pipeline is
+     * quiescent, waiting for wakeCPU() instead.
+     */
+    bool gateQuiescentTick;
+
+    /** Quiescent ticks needed before gating: by then nothing that was
+     * written before the pipeline stalled is left in the time buffers.
+     */
+    unsigned quiescentTicksToGate;
+
+    /** Number of consecutive ticks that left the pipeline quiescent. */
+    unsigned quiescentTicks;
+
+    /** Whether the tick event is descheduled until the next wakeCPU(). */
+    bool tickGated;
+
   public:
     /** Records that there was time buffer activity this cycle. */
     void activityThisCycle() { activityRec.activity(); }
@@ -773,6 +809,10 @@ class FullO3CPU : public BaseO3CPU
     /** Stat for total number of cycles the CPU spends descheduled due to a
      * quiesce operation or waiting for an interrupt. */
     Stats::Scalar quiesceCycles;
+    /** Stat for the number of times the tick gated itself. */
+    Stats::Scalar timesGated;
+    /** Stat for the number of cycles skipped while the tick was gated. */
+    Stats::Scalar gatedCycles;
     /** Stat for the number of committed instructions per thread. */
     Stats::Vector committedInsts;
     /** Stat for the number of committed ops (including micro ops) per thread. */
@@ -823,6 +863,14 @@ class FullO3CPU : public BaseO3CPU
     // whether to enable doppelganger loads
     bool DOPP;
 
+    // Akk[DOPP]: address predictor for doppelganger loads. If NULL, the
+    // doppelganger is issued to the address computed from its operands.
+    DoppAddrPredictor *doppAddrPred;
+
+    // Akk[DOPP2]: on a doppelganger address misprediction, replay the
+    // dependents that consumed the wrong value instead of squashing
+    bool doppSelectiveReplay;
+
     // whether add implicit flow protection
     bool impChannel;
 
@@ -128,6 +128,12 @@ class DefaultDecode
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /** Is decode either blocked by rename or idle with nothing to decode? */
+    bool isQuiescent() const;
+
+    /** Counts skipped cycles as blocked or idle decode cycles. */
+    void skipCycles(Cycles cycles);
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom() { resetStage(); }
 
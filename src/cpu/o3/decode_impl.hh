@@ -216,6 +216,38 @@ DefaultDecode<Impl>::isDrained() const
     return true;
 }
 
+template <class Impl>
+bool
+DefaultDecode<Impl>::isQuiescent() const
+{
+    for (auto tid : *activeThreads) {
+        if (!insts[tid].empty())
+            return false;
+
+        if (decodeStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if ((decodeStatus[tid] != Running &&
+                    decodeStatus[tid] != Idle) || checkStall(tid)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class Impl>
+void
+DefaultDecode<Impl>::skipCycles(Cycles cycles)
+{
+    for (auto tid : *activeThreads) {
+        if (decodeStatus[tid] == Blocked)
+            decodeBlockedCycles += cycles;
+        else
+            decodeIdleCycles += cycles;
+    }
+}
+
 template<class Impl>
 bool
 DefaultDecode<Impl>::checkStall(ThreadID tid) const
@@ -0,0 +1,400 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/dopp_addr_pred.hh"
+
+#include <algorithm>
+#include <iterator>
+
+#include "base/intmath.hh"
+#include "base/logging.hh"
+
+DoppAddrPredictor::DoppAddrPredictor(const Params *params)
+    : SimObject(params),
+      numThreads(params->numThreads),
+      tableEntries(params->tableEntries),
+      confBits(params->confBits),
+      confThreshold(params->confThreshold),
+      instShiftAmt(params->instShiftAmt)
+{
+    if (!isPowerOf2(tableEntries))
+        fatal("Invalid doppelganger predictor table size!\n");
+
+    if (confBits == 0 || confBits > 8 || confThreshold > (1U << confBits) - 1)
+        fatal("Invalid doppelganger predictor confidence threshold!\n");
+}
+
+void
+DoppAddrPredictor::regStats()
+{
+    SimObject::regStats();
+
+    lookups
+        .name(name() + ".lookups")
+        .desc("Number of doppelganger address lookups")
+        ;
+
+    predictions
+        .name(name() + ".predictions")
+        .desc("Number of confident doppelganger address predictions")
+        ;
+
+    updates
+        .name(name() + ".updates")
+        .desc("Number of committed loads trained on")
+        ;
+
+    squashed
+        .name(name() + ".squashed")
+        .desc("Number of predictions released by squashes")
+        ;
+}
+
+bool
+DoppAddrPredictor::predict(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                           Addr &addr)
+{
+    ++lookups;
+
+    if (!lookup(tid, pc, seq_num, addr))
+        return false;
+
+    ++predictions;
+    return true;
+}
+
+void
+DoppAddrPredictor::train(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                         Addr addr, bool predicted)
+{
+    ++updates;
+    update(tid, pc, seq_num, addr, predicted);
+}
+
+void
+DoppAddrPredictor::squash(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                          bool predicted)
+{
+    if (predicted)
+        ++squashed;
+    release(tid, pc, seq_num, predicted);
+}
+
+LastAddrDoppPredictor::LastAddrDoppPredictor(
+        const LastAddrDoppPredictorParams *params)
+    : DoppAddrPredictor(params),
+      table(tableEntries)
+{
+    for (auto &entry : table)
+        entry.conf.setBits(confBits);
+}
+
+bool
+LastAddrDoppPredictor::lookup(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                              Addr &addr)
+{
+    const Entry &entry = table[tableIndex(tid, pc, tableEntries)];
+
+    if (!entry.valid || entry.tid != tid || entry.pc != pc ||
+        !confident(entry.conf))
+        return false;
+
+    addr = entry.lastAddr;
+    return true;
+}
+
+void
+LastAddrDoppPredictor::update(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                              Addr addr, bool predicted)
+{
+    Entry &entry = table[tableIndex(tid, pc, tableEntries)];
+
+    if (!entry.valid || entry.tid != tid || entry.pc != pc) {
+        entry.valid = true;
+        entry.tid = tid;
+        entry.pc = pc;
+        entry.lastAddr = addr;
+        entry.conf.reset();
+        return;
+    }
+
+    if (entry.lastAddr == addr) {
+        entry.conf.increment();
+    } else {
+        entry.conf.reset();
+        entry.lastAddr = addr;
+    }
+}
+
+StrideDoppPredictor::StrideDoppPredictor(
+        const StrideDoppPredictorParams *params)
+    : DoppAddrPredictor(params),
+      table(tableEntries)
+{
+    for (auto &entry : table)
+        entry.conf.setBits(confBits);
+}
+
+StrideDoppPredictor::Entry *
+StrideDoppPredictor::findEntry(ThreadID tid, Addr pc)
+{
+    Entry &entry = table[tableIndex(tid, pc, tableEntries)];
+
+    if (!entry.valid || entry.tid != tid || entry.pc != pc)
+        return NULL;
+
+    return &entry;
+}
+
+bool
+StrideDoppPredictor::lookup(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                            Addr &addr)
+{
+    Entry *entry = findEntry(tid, pc);
+
+    if (!entry || !confident(entry->conf))
+        return false;
+
+    // The load is the (inflight + 1)-th instance after the last
+    // committed one.
+    ++entry->inflight;
+    addr = entry->lastAddr + entry->stride * (int64_t)entry->inflight;
+    return true;
+}
+
+void
+StrideDoppPredictor::release(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                             bool predicted)
+{
+    Entry *entry = findEntry(tid, pc);
+
+    if (predicted && entry && entry->inflight > 0)
+        --entry->inflight;
+}
+
+void
+StrideDoppPredictor::update(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                            Addr addr, bool predicted)
+{
+    Entry *entry = findEntry(tid, pc);
+
+    if (!entry) {
+        // A confident load keeps its entry against conflicting ones for
+        // a while, so two loads sharing an entry do not evict each
+        // other on every update.
+        entry = &table[tableIndex(tid, pc, tableEntries)];
+        if (entry->valid && entry->conf.read() > 0) {
+            entry->conf.decrement();
+            return;
+        }
+
+        // Replace the entry; in-flight predictions of the old load are
+        // simply not released anymore.
+        entry->valid = true;
+        entry->tid = tid;
+        entry->pc = pc;
+        entry->lastAddr = addr;
+        entry->stride = 0;
+        entry->inflight = 0;
+        entry->conf.reset();
+        return;
+    }
+
+    if (predicted && entry->inflight > 0)
+        --entry->inflight;
+
+    int64_t stride = (int64_t)(addr - entry->lastAddr);
+    if (stride == entry->stride) {
+        entry->conf.increment();
+    } else {
+        entry->conf.reset();
+        entry->stride = stride;
+    }
+    entry->lastAddr = addr;
+}
+
+ContextDoppPredictor::ContextDoppPredictor(
+        const ContextDoppPredictorParams *params)
+    : DoppAddrPredictor(params),
+      historyLength(params->historyLength),
+      contextEntries(params->contextEntries),
+      histTable(tableEntries),
+      ctxTable(contextEntries)
+{
+    if (historyLength == 0)
+        fatal("Context doppelganger predictor needs a history!\n");
+
+    if (!isPowerOf2(contextEntries))
+        fatal("Invalid context doppelganger predictor table size!\n");
+
+    for (auto &entry : histTable)
+        entry.hist.resize(historyLength, 0);
+
+    for (auto &entry : ctxTable)
+        entry.conf.setBits(confBits);
+}
+
+bool
+ContextDoppPredictor::context(const HistEntry &entry, size_t num_spec,
+                              uint64_t &ctx) const
+{
+    // The window is the last historyLength addresses of the committed
+    // history followed by the first num_spec in-flight ones, hashed
+    // oldest to youngest so that the same sequence hashes the same
+    // regardless of where the circular buffer starts.
+    uint64_t hash = entry.pc >> instShiftAmt;
+    for (size_t i = num_spec; i < num_spec + historyLength; ++i) {
+        Addr a;
+        if (i < historyLength) {
+            a = entry.hist[(entry.head + i) % historyLength];
+        } else {
+            const SpecAddr &spec = entry.spec[i - historyLength];
+            if (!spec.known)
+                return false;
+            a = spec.addr;
+        }
+        hash = (hash * 0x9e3779b97f4a7c15ULL) ^ a ^ (hash >> 29);
+    }
+    ctx = hash;
+    return true;
+}
+
+bool
+ContextDoppPredictor::lookup(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                             Addr &addr)
+{
+    HistEntry &hist_entry = histTable[tableIndex(tid, pc, tableEntries)];
+
+    if (!hist_entry.valid || hist_entry.tid != tid || hist_entry.pc != pc)
+        return false;
+
+    // Append the expected address to the history even if it is not
+    // confident enough to predict, as the branch predictors do with the
+    // predicted direction; younger instances are looked up after it.
+    SpecAddr spec{seq_num, 0, false};
+    bool confident_pred = false;
+
+    uint64_t ctx;
+    if (context(hist_entry, hist_entry.spec.size(), ctx)) {
+        const CtxEntry &ctx_entry = ctxTable[ctx & (contextEntries - 1)];
+        if (ctx_entry.valid && ctx_entry.tag == ctx) {
+            spec.addr = ctx_entry.nextAddr;
+            spec.known = true;
+            confident_pred = confident(ctx_entry.conf);
+        }
+    }
+
+    hist_entry.spec.push_back(spec);
+
+    if (!confident_pred)
+        return false;
+
+    addr = spec.addr;
+    return true;
+}
+
+void
+ContextDoppPredictor::release(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                              bool predicted)
+{
+    HistEntry &hist_entry = histTable[tableIndex(tid, pc, tableEntries)];
+
+    if (!hist_entry.valid || hist_entry.tid != tid || hist_entry.pc != pc)
+        return;
+
+    // Squashes walk youngest first, so the load is normally the last
+    // in-flight one.
+    for (auto it = hist_entry.spec.rbegin(); it != hist_entry.spec.rend();
+         ++it) {
+        if (it->seqNum == seq_num) {
+            hist_entry.spec.erase(std::next(it).base());
+            return;
+        }
+    }
+}
+
+void
+ContextDoppPredictor::update(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                             Addr addr, bool predicted)
+{
+    HistEntry &hist_entry = histTable[tableIndex(tid, pc, tableEntries)];
+
+    if (!hist_entry.valid || hist_entry.tid != tid || hist_entry.pc != pc) {
+        hist_entry.valid = true;
+        hist_entry.tid = tid;
+        hist_entry.pc = pc;
+        std::fill(hist_entry.hist.begin(), hist_entry.hist.end(), 0);
+        hist_entry.head = 0;
+        hist_entry.spec.clear();
+    } else {
+        uint64_t ctx;
+        context(hist_entry, 0, ctx);
+        CtxEntry &ctx_entry = ctxTable[ctx & (contextEntries - 1)];
+
+        if (ctx_entry.valid && ctx_entry.tag == ctx &&
+            ctx_entry.nextAddr == addr) {
+            ctx_entry.conf.increment();
+        } else {
+            ctx_entry.valid = true;
+            ctx_entry.tag = ctx;
+            ctx_entry.nextAddr = addr;
+            ctx_entry.conf.reset();
+        }
+
+        // Loads commit in order, so the load is the oldest in-flight
+        // one; older leftovers are from loads that were looked up
+        // before an entry replacement and never released.
+        while (!hist_entry.spec.empty() &&
+               hist_entry.spec.front().seqNum <= seq_num)
+            hist_entry.spec.pop_front();
+    }
+
+    // Move the address to the committed history, overwriting the oldest
+    // one. Younger in-flight addresses that were derived from a wrong
+    // expectation are left alone; they are replaced as they commit.
+    hist_entry.hist[hist_entry.head] = addr;
+    hist_entry.head = (hist_entry.head + 1) % historyLength;
+}
+
+LastAddrDoppPredictor *
+LastAddrDoppPredictorParams::create()
+{
+    return new LastAddrDoppPredictor(this);
+}
+
+StrideDoppPredictor *
+StrideDoppPredictorParams::create()
+{
+    return new StrideDoppPredictor(this);
+}
+
+ContextDoppPredictor *
+ContextDoppPredictorParams::create()
+{
+    return new ContextDoppPredictor(this);
+}
@@ -0,0 +1,270 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_DOPP_ADDR_PRED_HH__
+#define __CPU_O3_DOPP_ADDR_PRED_HH__
+
+#include <deque>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/types.hh"
+#include "cpu/inst_seq.hh"
+#include "cpu/pred/sat_counter.hh"
+#include "params/ContextDoppPredictor.hh"
+#include "params/DoppAddrPredictor.hh"
+#include "params/LastAddrDoppPredictor.hh"
+#include "params/StrideDoppPredictor.hh"
+#include "sim/sim_object.hh"
+
+/**
+ * Akk[DOPP]: base class of the doppelganger load address predictors.
+ * A prediction is made for every load at dispatch. If it is confident,
+ * the doppelganger of a tainted load is issued to the predicted address
+ * rather than to the address computed from its tainted operands. The
+ * predictor is trained in program order as loads commit. Loads are
+ * released as the ROB squashes them (youngest first) so that in-flight
+ * state is repaired before the correct path is dispatched.
+ */
+class DoppAddrPredictor : public SimObject
+{
+  public:
+    typedef DoppAddrPredictorParams Params;
+
+    DoppAddrPredictor(const Params *params);
+
+    void regStats() override;
+
+    /**
+     * Predicts the effective address of a load.
+     * @param tid The thread of the load.
+     * @param pc The PC of the load.
+     * @param seq_num The sequence number of the load.
+     * @param addr Set to the predicted address if a prediction is made.
+     * @return Whether the predictor is confident enough to predict.
+     */
+    bool predict(ThreadID tid, Addr pc, InstSeqNum seq_num, Addr &addr);
+
+    /**
+     * Trains the predictor with the address of a committed load.
+     * @param predicted Whether predict() returned true for this load.
+     */
+    void train(ThreadID tid, Addr pc, InstSeqNum seq_num, Addr addr,
+               bool predicted);
+
+    /**
+     * Releases the in-flight state of a squashed load. Called for every
+     * squashed load that was looked up, youngest first.
+     * @param predicted Whether predict() returned true for this load.
+     */
+    void squash(ThreadID tid, Addr pc, InstSeqNum seq_num, bool predicted);
+
+  protected:
+    /** Predictor specific lookup, see predict(). */
+    virtual bool lookup(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                        Addr &addr) = 0;
+
+    /** Predictor specific training, see train(). */
+    virtual void update(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                        Addr addr, bool predicted) = 0;
+
+    /** Predictor specific release of a squashed load, see squash(). */
+    virtual void release(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                         bool predicted) { }
+
+    /** Index of a load into a table of the given (power of 2) size. */
+    unsigned tableIndex(ThreadID tid, Addr pc, unsigned entries) const
+    { return ((pc >> instShiftAmt) ^ tid) & (entries - 1); }
+
+    /** Whether a confidence counter allows a prediction. */
+    bool confident(const SatCounter &conf) const
+    { return conf.read() >= confThreshold; }
+
+    /** Number of threads. */
+    const unsigned numThreads;
+
+    /** Number of per-PC table entries. */
+    const unsigned tableEntries;
+
+    /** Bits of the confidence counters. */
+    const unsigned confBits;
+
+    /** Confidence needed to predict. */
+    const unsigned confThreshold;
+
+    /** Number of bits to shift the PC by. */
+    const unsigned instShiftAmt;
+
+    /** Stat for the number of lookups. */
+    Stats::Scalar lookups;
+    /** Stat for the number of confident predictions. */
+    Stats::Scalar predictions;
+    /** Stat for the number of committed loads trained on. */
+    Stats::Scalar updates;
+    /** Stat for the number of predictions released by squashes. */
+    Stats::Scalar squashed;
+};
+
+/**
+ * Predicts that a load accesses the same address as its last instance.
+ */
+class LastAddrDoppPredictor : public DoppAddrPredictor
+{
+  public:
+    LastAddrDoppPredictor(const LastAddrDoppPredictorParams *params);
+
+  protected:
+    bool lookup(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                Addr &addr) override;
+    void update(ThreadID tid, Addr pc, InstSeqNum seq_num, Addr addr,
+                bool predicted) override;
+
+  private:
+    struct Entry
+    {
+        bool valid = false;
+        ThreadID tid = 0;
+        Addr pc = 0;
+        Addr lastAddr = 0;
+        SatCounter conf;
+    };
+
+    std::vector<Entry> table;
+};
+
+/**
+ * Predicts lastAddr + stride for a load. Instances of the same load
+ * that are dispatched before the older ones commit are extrapolated by
+ * the number of in-flight predictions of the entry. A load whose PC
+ * misses takes the entry only once the confidence of the resident one
+ * has decayed to zero.
+ */
+class StrideDoppPredictor : public DoppAddrPredictor
+{
+  public:
+    StrideDoppPredictor(const StrideDoppPredictorParams *params);
+
+  protected:
+    bool lookup(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                Addr &addr) override;
+    void update(ThreadID tid, Addr pc, InstSeqNum seq_num, Addr addr,
+                bool predicted) override;
+    void release(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                 bool predicted) override;
+
+  private:
+    struct Entry
+    {
+        bool valid = false;
+        ThreadID tid = 0;
+        Addr pc = 0;
+        Addr lastAddr = 0;
+        int64_t stride = 0;
+        /** Predictions made but not yet committed or squashed. */
+        unsigned inflight = 0;
+        SatCounter conf;
+    };
+
+    Entry *findEntry(ThreadID tid, Addr pc);
+
+    std::vector<Entry> table;
+};
+
+/**
+ * Context (finite context method) predictor: the PC and the last
+ * historyLength addresses of a load index a second table holding the
+ * address that followed that context last time.
+ *
+ * Like the global history of the branch predictors, the history is
+ * updated speculatively: every lookup of a tracked load appends the
+ * address it expects, so that back-to-back instances in flight see
+ * each other rather than all reusing the last committed context. The
+ * speculative part is repaired on squash and replaced by the actual
+ * address as each load commits.
+ */
+class ContextDoppPredictor : public DoppAddrPredictor
+{
+  public:
+    ContextDoppPredictor(const ContextDoppPredictorParams *params);
+
+  protected:
+    bool lookup(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                Addr &addr) override;
+    void update(ThreadID tid, Addr pc, InstSeqNum seq_num, Addr addr,
+                bool predicted) override;
+    void release(ThreadID tid, Addr pc, InstSeqNum seq_num,
+                 bool predicted) override;
+
+  private:
+    /** Address appended to the history by an in-flight load. */
+    struct SpecAddr
+    {
+        InstSeqNum seqNum;
+        Addr addr;
+        /** False if there was no context entry to take addr from. */
+        bool known;
+    };
+
+    /** Per-PC address history. */
+    struct HistEntry
+    {
+        bool valid = false;
+        ThreadID tid = 0;
+        Addr pc = 0;
+        /** Circular buffer of the last historyLength committed addresses. */
+        std::vector<Addr> hist;
+        unsigned head = 0;
+        /** In-flight addresses, oldest first, following hist. */
+        std::deque<SpecAddr> spec;
+    };
+
+    /** Context-indexed next address. */
+    struct CtxEntry
+    {
+        bool valid = false;
+        uint64_t tag = 0;
+        Addr nextAddr = 0;
+        SatCounter conf;
+    };
+
+    /**
+     * Hashes the PC and the last historyLength addresses of an entry,
+     * including the first num_spec in-flight ones, into a context.
+     * @return False if one of those addresses is unknown.
+     */
+    bool context(const HistEntry &entry, size_t num_spec,
+                 uint64_t &ctx) const;
+
+    const unsigned historyLength;
+    const unsigned contextEntries;
+
+    std::vector<HistEntry> histTable;
+    std::vector<CtxEntry> ctxTable;
+};
+
+#endif // __CPU_O3_DOPP_ADDR_PRED_HH__
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/dopp_data_pool.hh"
+
+#include <cassert>
+
+void
+DoppDataPool::init(unsigned num_slots, unsigned buf_size)
+{
+    assert(numInUse() == 0);
+
+    numSlots = num_slots;
+    bufSize = buf_size;
+
+    slab.assign(2 * 2 * numSlots * bufSize, 0);
+    bufs.assign(2 * numSlots, Buffer());
+    slotBuf.assign(numSlots, -1);
+
+    freeSpares.clear();
+    for (int buf = 2 * numSlots - 1; buf >= (int)numSlots; --buf)
+        freeSpares.push_back(buf);
+}
+
+int
+DoppDataPool::acquire(unsigned slot)
+{
+    assert(slot < numSlots);
+
+    if (slotBuf[slot] >= 0)
+        return slotBuf[slot];
+
+    int buf = slot;
+    if (bufs[buf].pins) {
+        // A squashed load's doppelganger is still writing to it.
+        if (freeSpares.empty())
+            return -1;
+        buf = freeSpares.back();
+        freeSpares.pop_back();
+    }
+
+    assert(bufs[buf].owner < 0);
+    bufs[buf].owner = slot;
+    slotBuf[slot] = buf;
+    return buf;
+}
+
+void
+DoppDataPool::release(unsigned slot)
+{
+    assert(slot < numSlots);
+
+    int buf = slotBuf[slot];
+    if (buf < 0)
+        return;
+
+    slotBuf[slot] = -1;
+    bufs[buf].owner = -1;
+    if (isSpare(buf) && !bufs[buf].pins)
+        freeSpares.push_back(buf);
+}
+
+void
+DoppDataPool::unpin(int buf)
+{
+    assert(bufs[buf].pins > 0);
+
+    if (--bufs[buf].pins == 0 && isSpare(buf) && bufs[buf].owner < 0)
+        freeSpares.push_back(buf);
+}
+
+unsigned
+DoppDataPool::numInUse() const
+{
+    unsigned in_use = 0;
+    for (const auto &buf : bufs)
+        in_use += (buf.owner >= 0 || buf.pins);
+    return in_use;
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_DOPP_DATA_POOL_HH__
+#define __CPU_O3_DOPP_DATA_POOL_HH__
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * Akk[DOPP]: fixed-capacity slab holding the data and store-forward
+ * buffers of doppelganger loads, so that issuing one does no heap
+ * allocation. Buffer i belongs to load queue slot i. Since the memory
+ * system writes responses straight into the buffer, a buffer stays
+ * pinned while a doppelganger packet targeting it is in flight, even if
+ * its load was squashed meanwhile; a new load in that slot then takes
+ * one of the spare buffers until the pinned one drains.
+ */
+class DoppDataPool
+{
+  public:
+    DoppDataPool() : numSlots(0), bufSize(0) { }
+
+    /**
+     * Sizes the pool. Only legal while no buffer is in use, as in-flight
+     * packets point into the slab.
+     * @param num_slots Number of load queue slots.
+     * @param buf_size Size of each data buffer, a cache line.
+     */
+    void init(unsigned num_slots, unsigned buf_size);
+
+    /** Size of each data buffer. */
+    unsigned bufferSize() const { return bufSize; }
+
+    /**
+     * Returns the buffer of a load queue slot, assigning one if the slot
+     * has none yet.
+     * @return The buffer index, or -1 if all spares are pinned.
+     */
+    int acquire(unsigned slot);
+
+    /** Buffer assigned to a slot, -1 if none. */
+    int bufferOf(unsigned slot) const { return slotBuf[slot]; }
+
+    /** Releases the buffer of a slot whose load left the queue. */
+    void release(unsigned slot);
+
+    /** Marks a doppelganger packet targeting buf as in flight. */
+    void pin(int buf) { ++bufs[buf].pins; }
+
+    /** Marks a doppelganger packet targeting buf as returned. */
+    void unpin(int buf);
+
+    /** Data buffer of buf. */
+    uint8_t *data(int buf) { return &slab[2 * buf * bufSize]; }
+
+    /** Store-forward buffer of buf. */
+    uint8_t *stFwdData(int buf) { return &slab[(2 * buf + 1) * bufSize]; }
+
+    /** Number of buffers assigned or pinned, for debugging. */
+    unsigned numInUse() const;
+
+  private:
+    struct Buffer
+    {
+        /** Load queue slot owning the buffer, -1 if none. */
+        int owner = -1;
+        /** In-flight doppelganger packets writing to the buffer. */
+        unsigned pins = 0;
+    };
+
+    bool isSpare(int buf) const { return buf >= (int)numSlots; }
+
+    unsigned numSlots;
+
+    unsigned bufSize;
+
+    /** Data and store-forward halves of every buffer, back to back. */
+    std::vector<uint8_t> slab;
+
+    /** Slots [0, numSlots) own their primary buffers, then the spares. */
+    std::vector<Buffer> bufs;
+
+    /** Buffer assigned to each slot, -1 if none. */
+    std::vector<int> slotBuf;
+
+    /** Spares neither owned nor pinned. */
+    std::vector<int> freeSpares;
+};
+
+#endif // __CPU_O3_DOPP_DATA_POOL_HH__
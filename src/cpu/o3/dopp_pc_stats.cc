@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "cpu/o3/dopp_pc_stats.hh"
+
+#include "base/cprintf.hh"
+
+namespace {
+
+const char *eventNames[DoppPCStats::NumEvents] = {
+    "issued", "completed", "predHit", "predMiss", "squashed",
+    "stFwd", "killed", "blocked", "faulted"
+};
+
+} // anonymous namespace
+
+void
+DoppPCStats::Entry::printHeader(std::ostream &os)
+{
+    for (int e = 0; e < NumEvents; ++e)
+        ccprintf(os, " %12s", eventNames[e]);
+    ccprintf(os, " %8s", "hitRate");
+}
+
+void
+DoppPCStats::Entry::print(std::ostream &os) const
+{
+    for (int e = 0; e < NumEvents; ++e)
+        ccprintf(os, " %12d", counts[e]);
+    Counter verified = counts[PredHit] + counts[PredMiss];
+    ccprintf(os, " %8.4f",
+             verified ? (double)counts[PredHit] / verified : 0.0);
+}
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_DOPP_PC_STATS_HH__
+#define __CPU_O3_DOPP_PC_STATS_HH__
+
+#include <array>
+#include <ostream>
+#include <string>
+
+#include "base/types.hh"
+#include "cpu/o3/pc_stats_table.hh"
+
+/**
+ * Akk[DOPP]: per static PC breakdown of the doppelganger load events.
+ * Only the top-N PCs by issued doppelgangers are dumped, see
+ * PCStatsTable.
+ */
+class DoppPCStats
+{
+  public:
+    enum Event {
+        Issued,         // doppelganger sent to the LSQ
+        Completed,      // doppelganger returned data without a fault
+        PredHit,        // real load matched the predicted address
+        PredMiss,       // real load did not match, dependents replayed
+        Squashed,       // squashDueToDOPPMispredict was signalled
+        StoreForwarded, // doppelganger data forwarded from a store
+        Killed,         // dropped on a partial store-forward
+        Blocked,        // dropped because the cache was blocked
+        Faulted,        // dropped on a translation fault
+        NumEvents
+    };
+
+    /**
+     * @param name Name of the table and of its output file.
+     * @param top_n Number of PCs dumped, 0 disables the table.
+     */
+    DoppPCStats(const std::string &name, unsigned top_n)
+        : table(name, top_n)
+    {
+    }
+
+    /** Counts an event of the doppelganger of the load at pc. */
+    void record(Addr pc, Event event)
+    {
+        if (table.enabled())
+            table[pc].counts[event]++;
+    }
+
+    /** Writes the top-N PCs, called back on a stats dump. */
+    void dump() { table.dump(); }
+
+    /** Clears the table, called back on a stats reset. */
+    void reset() { table.reset(); }
+
+  private:
+    struct Entry {
+        std::array<Counter, NumEvents> counts{};
+
+        Counter rank() const { return counts[Issued]; }
+        static void printHeader(std::ostream &os);
+        void print(std::ostream &os) const;
+    };
+
+    PCStatsTable<Entry> table;
+};
+
+#endif // __CPU_O3_DOPP_PC_STATS_HH__
@@ -242,6 +242,16 @@ class DefaultFetch
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /**
+     * Would ticking leave fetch unchanged? True while fetch waits on an
+     * I-cache response, or while its queue to decode is full and the
+     * current fetch buffer still covers the PC.
+     */
+    bool isQuiescent();
+
+    /** Account for cycles the CPU skipped while fetch was quiescent. */
+    void skipCycles(Cycles cycles);
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
@@ -479,6 +479,60 @@ DefaultFetch<Impl>::isDrained() const
     return !finishTranslationEvent.scheduled();
 }
 
+template <class Impl>
+bool
+DefaultFetch<Impl>::isQuiescent()
+{
+    if (interruptPending || finishTranslationEvent.scheduled())
+        return false;
+
+    for (auto tid : *activeThreads) {
+        if (stalls[tid].drain ||
+            (!fetchQueue[tid].empty() && !stalls[tid].decode)) {
+            return false;
+        }
+
+        // A delayed squash would be applied as soon as it is untainted
+        for (const auto &req : delayedSquashReqList.delayedSquashes[tid]) {
+            if (!req.misp_inst->isArgsTainted())
+                return false;
+        }
+
+        if (fetchStatus[tid] == IcacheWaitResponse)
+            continue;
+
+        Addr fetch_addr = (pc[tid].instAddr() + fetchOffset[tid]) &
+            BaseCPU::PCMask;
+        if (fetchStatus[tid] != Running ||
+            fetchQueue[tid].size() < fetchQueueSize ||
+            !fetchBufferValid[tid] ||
+            fetchBufferAlignPC(fetch_addr) != fetchBufferPC[tid]) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class Impl>
+void
+DefaultFetch<Impl>::skipCycles(Cycles cycles)
+{
+    for (auto tid : *activeThreads) {
+        if (fetchStatus[tid] == IcacheWaitResponse)
+            icacheStallCycles += cycles;
+        else
+            fetchCycles += cycles;
+    }
+
+    fetchNisnDist.sample(0, cycles);
+
+    // tick() draws the thread to send to decode from once per cycle, keep
+    // the random stream where it would have been
+    for (Cycles i(0); i < cycles; ++i)
+        random_mt.random<uint8_t>(0, activeThreads->size() - 1);
+}
+
 template <class Impl>
 void
 DefaultFetch<Impl>::takeOverFrom()
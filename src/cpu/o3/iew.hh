@@ -48,6 +48,7 @@
 
 #include "base/statistics.hh"
 #include "cpu/o3/comm.hh"
+#include "cpu/o3/dopp_pc_stats.hh"
 #include "cpu/o3/lsq.hh"
 #include "cpu/o3/scoreboard.hh"
 #include "cpu/timebuf.hh"
@@ -168,6 +169,16 @@ class DefaultIEW
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /**
+     * Is IEW waiting on memory or FU completions only? Dispatch has to be
+     * blocked by a full IQ or have nothing to dispatch, and neither the
+     * IQ nor the LSQ may have work of their own left.
+     */
+    bool isQuiescent();
+
+    /** Updates the per-cycle IEW and IQ stats for skipped cycles. */
+    void skipCycles(Cycles cycles);
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
@@ -248,6 +259,20 @@ class DefaultIEW
      */
     void squashDueToDOPPMispredict(DynInstPtr &inst, ThreadID tid);
 
+    // Akk[DOPP2]
+    /**
+     * Handles a mispredicted doppelganger, by replaying its dependents if
+     * selective replay is enabled and possible, or by squashing otherwise.
+     */
+    void handleDOPPMispredict(DynInstPtr &inst, ThreadID tid);
+
+    /**
+     * Sends the instructions that consumed a mispredicted doppelganger
+     * value back to the IQ to issue again. Returns false if they have to
+     * be squashed.
+     */
+    bool replayDOPPDependents(DynInstPtr &inst);
+
     /** Sends commit proper information for a squash due to a memory order
      * violation.
      */
@@ -499,6 +524,26 @@ class DefaultIEW
     Stats::Formula wbRate;
     /** Average number of woken instructions per writeback. */
     Stats::Formula wbFanout;
+
+    // Akk[DOPP]
+    /** Stat for tainted loads that could have issued a doppelganger. */
+    Stats::Scalar doppEligible;
+    /** Stat for doppelganger loads issued. */
+    Stats::Scalar doppIssued;
+    /** Stat for the fraction of eligible loads issuing a doppelganger. */
+    Stats::Formula doppCoverage;
+    /** Stat for squashes due to a doppelganger address misprediction. */
+    Stats::Scalar doppMispredictSquashes;
+    /** Stat for instructions squashed by those squashes. */
+    Stats::Scalar doppSquashedInsts;
+    /** Stat for mispredictions handled by replaying the dependents. */
+    Stats::Scalar doppReplays;
+    /** Stat for instructions re-executed by those replays. */
+    Stats::Scalar doppReplayedInsts;
+
+  public:
+    /** Per-PC doppelganger events, shared with the LSQ units. */
+    DoppPCStats doppPCStats;
 };
 
 #endif // __CPU_O3_IEW_HH__
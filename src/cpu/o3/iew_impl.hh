@@ -51,6 +51,7 @@
 #include <queue>
 
 #include "arch/utility.hh"
+#include "base/callback.hh"
 #include "config/the_isa.hh"
 #include "cpu/checker/cpu.hh"
 #include "cpu/o3/fu_pool.hh"
@@ -77,7 +78,8 @@ DefaultIEW<Impl>::DefaultIEW(O3CPU *_cpu, DerivO3CPUParams *params)
       dispatchWidth(params->dispatchWidth),
       issueWidth(params->issueWidth),
       wbWidth(params->wbWidth),
-      numThreads(params->numThreads)
+      numThreads(params->numThreads),
+      doppPCStats(_cpu->name() + ".iew.doppPCs", params->doppPCStatsTopN)
 {
     if (dispatchWidth > Impl::MaxWidth)
         fatal("dispatchWidth (%d) is larger than compiled limit (%d),\n"
@@ -297,6 +299,46 @@ DefaultIEW<Impl>::regStats()
         .desc("insts written-back per cycle")
         .flags(total);
     wbRate = writebackCount / cpu->numCycles;
+
+    // Akk[DOPP]
+    doppEligible
+        .name(name() + ".doppEligible")
+        .desc("Number of tainted loads that could issue a doppelganger");
+
+    doppIssued
+        .name(name() + ".doppIssued")
+        .desc("Number of doppelganger loads issued");
+
+    doppCoverage
+        .name(name() + ".doppCoverage")
+        .desc("Fraction of eligible loads issuing a doppelganger");
+    doppCoverage = doppIssued / doppEligible;
+
+    doppMispredictSquashes
+        .name(name() + ".doppMispredictSquashes")
+        .desc("Number of squashes due to doppelganger address mispredictions");
+
+    doppSquashedInsts
+        .name(name() + ".doppSquashedInsts")
+        .desc("Number of instructions squashed due to doppelganger address "
+              "mispredictions");
+
+    doppReplays
+        .name(name() + ".doppReplays")
+        .desc("Number of doppelganger address mispredictions handled by "
+              "replaying the dependents");
+
+    doppReplayedInsts
+        .name(name() + ".doppReplayedInsts")
+        .desc("Number of instructions replayed due to doppelganger address "
+              "mispredictions");
+
+    if (cpu->DOPP) {
+        registerDumpCallback(new MakeCallback<DoppPCStats,
+                             &DoppPCStats::dump>(&doppPCStats));
+        registerResetCallback(new MakeCallback<DoppPCStats,
+                              &DoppPCStats::reset>(&doppPCStats));
+    }
 }
 
 template<class Impl>
@@ -405,6 +447,41 @@ DefaultIEW<Impl>::isDrained() const
     return drained;
 }
 
+template <class Impl>
+bool
+DefaultIEW<Impl>::isQuiescent()
+{
+    if (exeStatus != Idle || updateLSQNextCycle)
+        return false;
+
+    for (auto tid : *activeThreads) {
+        if (!insts[tid].empty())
+            return false;
+
+        if (dispatchStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if ((dispatchStatus[tid] != Running &&
+                    dispatchStatus[tid] != Idle) || checkStall(tid)) {
+            return false;
+        }
+    }
+
+    return instQueue.isQuiescent() && ldstQueue.isQuiescent();
+}
+
+template <class Impl>
+void
+DefaultIEW<Impl>::skipCycles(Cycles cycles)
+{
+    for (auto tid : *activeThreads) {
+        if (dispatchStatus[tid] == Blocked)
+            iewBlockCycles += cycles;
+    }
+
+    instQueue.skipCycles(cycles);
+}
+
 template <class Impl>
 void
 DefaultIEW<Impl>::drainSanityCheck() const
@@ -528,7 +605,55 @@ DefaultIEW<Impl>::squashDueToDOPPMispredict(DynInstPtr &inst, ThreadID tid)
         toCommit->includeSquashInst[tid] = false;
 
         wroteToTimeBuffer = true;
+
+        ++doppMispredictSquashes;
+        doppPCStats.record(inst->instAddr(), DoppPCStats::Squashed);
+
+        // everything younger in flight, from fetch to the ROB
+        for (auto it = cpu->instList.rbegin();
+             it != cpu->instList.rend() && (*it)->seqNum > inst->seqNum;
+             ++it) {
+            if ((*it)->threadNumber == tid && !(*it)->isSquashed())
+                ++doppSquashedInsts;
+        }
+    }
+}
+
+// Akk[DOPP2]
+template<class Impl>
+void
+DefaultIEW<Impl>::handleDOPPMispredict(DynInstPtr &inst, ThreadID tid)
+{
+    if (cpu->doppSelectiveReplay && replayDOPPDependents(inst))
+        return;
+
+    fetchRedirect[tid] = true;
+    // If incorrect, then signal the ROB that it must be squashed.
+    squashDueToDOPPMispredict(inst, tid);
+}
+
+template<class Impl>
+bool
+DefaultIEW<Impl>::replayDOPPDependents(DynInstPtr &inst)
+{
+    std::vector<DynInstPtr> replay_insts;
+    if (!instQueue.replayDOPPDependents(inst, replay_insts))
+        return false;
+
+    DPRINTF(IEW, "[tid:%i]: Replaying %i dependents of doppelganger "
+            "PC %s [sn:%i].\n", inst->threadNumber, replay_insts.size(),
+            inst->pcState(), inst->seqNum);
+
+    // They go through issue and the FUs again; whatever is renamed in
+    // the meantime waits for their new results
+    for (auto &replay_inst : replay_insts) {
+        for (int i = 0; i < replay_inst->numDestRegs(); i++)
+            scoreboard->unsetReg(replay_inst->renamedDestRegIdx(i));
     }
+
+    ++doppReplays;
+    doppReplayedInsts += replay_insts.size();
+    return true;
 }
 
 template<class Impl>
@@ -1289,8 +1414,19 @@ DefaultIEW<Impl>::executeInsts()
                 if (inst->fenceDelay() || inst->isDOPPLoadExecuting()){
                     DPRINTF(IEW, "Deferring load due to virtual fence.\n");
                     inst->onlyWaitForFence(true);
+                    if (cpu->STT && inst->fenceDelay())
+                        inst->taintStall(cpu->curCycle());
                     // Akk[DOPP]: do the doppelganger load
-                    if (cpu->DOPP) {
+                    if (cpu->DOPP && !inst->isDOPPLoadExecuting())
+                        ++doppEligible;
+                    // with an address predictor, only predicted loads get one
+                    if (cpu->DOPP &&
+                        (!cpu->doppAddrPred || inst->hasDOPPAddrPred())) {
+                        if (!inst->isDOPPLoadExecuting()) {
+                            ++doppIssued;
+                            doppPCStats.record(inst->instAddr(),
+                                               DoppPCStats::Issued);
+                        }
                         inst->isDOPPLoadExecuting(true);
                         ldstQueue.executeLoad(inst); // we don't care about faults for
                     }
@@ -1436,9 +1572,7 @@ DefaultIEW<Impl>::executeInsts()
             // Akk[DOPP2]
             else if (!inst->isDOPPPredCorrect() && inst->isDOPPLoadSuccess()) {
                 assert(inst->doppHasWokenDependents());
-                fetchRedirect[tid] = true;
-                // If incorrect, then signal the ROB that it must be squashed.
-                squashDueToDOPPMispredict(inst, tid);
+                handleDOPPMispredict(inst, tid);
             }
         } else {
             // Reset any state associated with redirects that will not
@@ -1777,9 +1911,7 @@ DefaultIEW<Impl>::checkDOPPMisprediction(DynInstPtr &inst)
 
         if (!inst->isDOPPPredCorrect() && inst->isDOPPLoadSuccess()) {
             assert(inst->doppHasWokenDependents());
-            fetchRedirect[tid] = true;
-            // If incorrect, then signal the ROB that it must be squashed.
-            squashDueToDOPPMispredict(inst, tid);
+            handleDOPPMispredict(inst, tid);
         }
 
         // if (inst->readPredTaken()) {
@@ -87,6 +87,7 @@ class InstructionQueue
     typedef typename Impl::DynInstPtr DynInstPtr;
 
     typedef typename Impl::CPUPol::IEW IEW;
+    typedef typename Impl::CPUPol::ROB ROB;
     typedef typename Impl::CPUPol::MemDepUnit MemDepUnit;
     typedef typename Impl::CPUPol::IssueStruct IssueStruct;
     typedef typename Impl::CPUPol::TimeStruct TimeStruct;
@@ -145,9 +146,22 @@ class InstructionQueue
     /** Sets the global time buffer. */
     void setTimeBuffer(TimeBuffer<TimeStruct> *tb_ptr);
 
+    /** [STT] Sets the ROB, which reports untainted stalled instructions. */
+    void setROB(ROB *rob_ptr) { rob = rob_ptr; }
+
     /** Determine if we are drained. */
     bool isDrained() const;
 
+    /**
+     * Determine if scheduling would leave the IQ unchanged: nothing is
+     * ready or about to execute, and every deferred memory instruction is
+     * held back by a fence rather than by a pending translation.
+     */
+    bool isQuiescent();
+
+    /** Samples the per-cycle issue stats for cycles the CPU skipped. */
+    void skipCycles(Cycles cycles);
+
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
 
@@ -203,6 +217,9 @@ class InstructionQueue
      */
     DynInstPtr getDeferredMemInstToExecute();
 
+    /** Can a deferred memory instruction be sent to execute now? */
+    bool isDeferredMemInstReady(const DynInstPtr &mem_inst) const;
+
     /** Gets a memory instruction that was blocked on the cache. NULL if none
      *  available.
      */
@@ -242,6 +259,17 @@ class InstructionQueue
      */
     int doppWakeDependents(DynInstPtr &completed_inst);
 
+    // Akk[DOPP2]
+    /**
+     * Puts the instructions that executed with the mispredicted
+     * doppelganger value of a load, directly or through other such
+     * instructions, back into the IQ to issue again, and makes their
+     * consumers wait for them. Returns false, changing nothing, if any of
+     * them cannot be replayed.
+     */
+    bool replayDOPPDependents(const DynInstPtr &load_inst,
+                              std::vector<DynInstPtr> &replay_insts);
+
     /** [Jiyong, STT] do a scan of instList and wake readyToIssue insts **/
     /** Used because wakeDependents cannot set readyToIssue if argsTainted **/
     void wakeUntaintInsts();
@@ -331,8 +359,13 @@ class InstructionQueue
     /** List of all the instructions in the IQ (some of which may be issued). */
     std::list<DynInstPtr> instList[Impl::MaxThreads];
 
-    /*** [Jiyong,STT] List of all stalled tainted ready instructions ***/
-    std::list<DynInstPtr> stalledTaintedInstList[Impl::MaxThreads];
+    /*** [Jiyong,STT] Number of stalled tainted ready instructions. They
+     *   are flagged InStallList and released when the ROB untaints them,
+     *   so there is no list to rescan. ***/
+    unsigned numStalledTaintedInsts[Impl::MaxThreads];
+
+    /** [STT] Pointer to the ROB. */
+    ROB *rob;
 
     /** List of instructions that are ready to be executed. */
     std::list<DynInstPtr> instsToExecute;
@@ -574,6 +607,10 @@ class InstructionQueue
 
     Stats::Scalar instsSetReady;
     Stats::Scalar instsStalledBeforeSetReady;
+    /** [STT] Sum over cycles of the number of stalled tainted insts. */
+    Stats::Scalar stallListOccupancy;
+    /** [STT] Average cycles an instruction spends stalled on taint. */
+    Stats::Formula avgStallListResidency;
 };
 
 #endif //__CPU_O3_INST_QUEUE_HH__
@@ -45,7 +45,9 @@
 #ifndef __CPU_O3_INST_QUEUE_IMPL_HH__
 #define __CPU_O3_INST_QUEUE_IMPL_HH__
 
+#include <algorithm>
 #include <limits>
+#include <unordered_set>
 #include <vector>
 
 #include "cpu/o3/fu_pool.hh"
@@ -95,6 +97,8 @@ InstructionQueue<Impl>::InstructionQueue(O3CPU *cpu_ptr, IEW *iew_ptr,
 {
     assert(fuPool);
 
+    rob = NULL;
+
     numThreads = params->numThreads;
 
     // Set the number of total physical registers
@@ -406,6 +410,15 @@ InstructionQueue<Impl>::regStats()
     instsStalledBeforeSetReady
         .name(name() + ".instsStalledBeforeSetReady")
         .desc("Number of instructions stalled before being added to ready list");
+
+    stallListOccupancy
+        .name(name() + ".stallListOccupancy")
+        .desc("Cumulative number of tainted instructions stalled per cycle");
+
+    avgStallListResidency
+        .name(name() + ".avgStallListResidency")
+        .desc("Average cycles a ready instruction is stalled on taint");
+    avgStallListResidency = stallListOccupancy / instsStalledBeforeSetReady;
 }
 
 template <class Impl>
@@ -416,6 +429,7 @@ InstructionQueue<Impl>::resetState()
     for (ThreadID tid = 0; tid <numThreads; tid++) {
         count[tid] = 0;
         instList[tid].clear();
+        numStalledTaintedInsts[tid] = 0;
     }
 
     // Initialize the number of free IQ entries.
@@ -485,6 +499,40 @@ InstructionQueue<Impl>::isDrained() const
     return drained;
 }
 
+template <class Impl>
+bool
+InstructionQueue<Impl>::isQuiescent()
+{
+    if (hasReadyInsts() || !instsToExecute.empty() || !retryMemInsts.empty())
+        return false;
+
+    // Translations and doppelganger loads finish without waking the CPU,
+    // so only loads that wait for a fence to lift can stay deferred
+    for (auto &mem_inst : deferredMemInsts) {
+        if (isDeferredMemInstReady(mem_inst) ||
+            !mem_inst->onlyWaitForFence() ||
+            (mem_inst->isDOPPLoadExecuting() &&
+             !mem_inst->hasDOPPTranslationCompleted()) ||
+            mem_inst->doppShouldWakeDependents()) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class Impl>
+void
+InstructionQueue<Impl>::skipCycles(Cycles cycles)
+{
+    numIssuedDist.sample(0, cycles);
+
+    if (cpu->STT && cpu->moreTransmitInsts) {
+        for (auto tid : *activeThreads)
+            stallListOccupancy += numStalledTaintedInsts[tid] * cycles;
+    }
+}
+
 template <class Impl>
 void
 InstructionQueue<Impl>::drainSanityCheck() const
@@ -1140,6 +1188,112 @@ InstructionQueue<Impl>::doppWakeDependents(DynInstPtr &completed_inst)
     return dependents;
 }
 
+// Akk[DOPP2]
+template <class Impl>
+bool
+InstructionQueue<Impl>::replayDOPPDependents(const DynInstPtr &load_inst,
+                                             std::vector<DynInstPtr> &replay_insts)
+{
+    ThreadID tid = load_inst->threadNumber;
+
+    // Instructions whose result is wrong; the load itself now holds the
+    // right value, but its doppelganger woke its dependents early
+    std::unordered_set<InstSeqNum> wrong;
+    // Consumers of a wrong result that have not read it yet
+    std::vector<DynInstPtr> waiting;
+    std::unordered_set<InstSeqNum> seen;
+
+    // Follow the register dependences forward from the load. The
+    // doppelganger value is tainted, so STT kept every consumer that
+    // could transmit it (memory accesses, branch resolution) from
+    // executing, and most of them are plain computation
+    std::vector<DynInstPtr> worklist(1, load_inst);
+    while (!worklist.empty()) {
+        DynInstPtr producer = worklist.back();
+        worklist.pop_back();
+
+        for (auto &inst : producer->getArgConsumers()) {
+            if (inst->isSquashed() || !seen.insert(inst->seqNum).second)
+                continue;
+
+            if (inst->isMemRef()) {
+                // its address or store data may already be in the LSQ
+                if (inst->isIssued() || inst->isDOPPLoadExecuting() ||
+                    inst->hasDOPPFinished())
+                    return false;
+            } else if (inst->isExecuted()) {
+                // a result still on its way to commit can't be taken back
+                if (inst->isControl() || inst->isNonSpeculative() ||
+                    inst->isSerializing() || inst->fault != NoFault ||
+                    !inst->checkCanCommit())
+                    return false;
+
+                wrong.insert(inst->seqNum);
+                replay_insts.push_back(inst);
+                worklist.push_back(inst);
+                continue;
+            }
+
+            // Not executed yet. It reads the load's operand after it is
+            // fixed, but has to wait for a replayed producer again
+            if (producer == load_inst) {
+                seen.erase(inst->seqNum);
+                continue;
+            }
+            if (inst->readyToIssue() || inst->isIssued() ||
+                inst->isInStallList() || inst->isNonSpeculative() ||
+                inst->isStoreConditional() || inst->isMemBarrier() ||
+                inst->isWriteBarrier())
+                return false;
+            waiting.push_back(inst);
+        }
+    }
+
+    if (replay_insts.size() > freeEntries)
+        return false;
+
+    // Issue them in program order, as they were dispatched
+    std::sort(replay_insts.begin(), replay_insts.end(),
+              [](const DynInstPtr &a, const DynInstPtr &b)
+              { return a->seqNum < b->seqNum; });
+
+    for (auto &inst : replay_insts) {
+        DPRINTF(IQ, "[tid:%i]: Replaying [sn:%lli] PC %s.\n",
+                tid, inst->seqNum, inst->pcState());
+
+        inst->clearIssued();
+        inst->clearExecuted();
+        inst->clearCanCommit();
+        inst->setInIQ();
+        --freeEntries;
+        count[tid]++;
+
+        addToProducers(inst);
+    }
+
+    // Everything reading a replayed result waits for it again; consumers
+    // dispatched later are caught by addToDependents()
+    waiting.insert(waiting.end(), replay_insts.begin(), replay_insts.end());
+    for (auto &inst : waiting) {
+        for (int i = 0; i < inst->numSrcRegs(); i++) {
+            DynInstPtr producer = inst->getArgProducer(i);
+            PhysRegIdPtr src_reg = inst->renamedSrcRegIdx(i);
+            if (!producer || !wrong.count(producer->seqNum) ||
+                src_reg->isFixedMapping())
+                continue;
+
+            inst->markSrcRegNotReady(i);
+            dependGraph.insert(src_reg->flatIndex(), inst);
+        }
+    }
+
+    // The first ones only read the load, they can issue right away
+    for (auto &inst : replay_insts)
+        addIfReady(inst);
+
+    assert(freeEntries == (numEntries - countInsts()));
+    return true;
+}
 
 /*** [Jiyong,STT] ***/
 template <class Impl>
@@ -1155,21 +1309,21 @@ InstructionQueue<Impl>::wakeUntaintInsts()
 
     while (threads != end) {
         ThreadID tid = *threads++;
-        for(auto it = stalledTaintedInstList[tid].begin(); it != stalledTaintedInstList[tid].end(); ) {
-            DynInstPtr inst = *it;
-            if (inst->isSquashed()) {
-                inst->removeFromStallList();
-                it = stalledTaintedInstList[tid].erase(it);
-            }
-            else if (inst->readyToIssue_UT()) {
-                inst->removeFromStallList();
-                addIfReady(inst);
-                it = stalledTaintedInstList[tid].erase(it);
-            }
-            else {
-                it++;
-            }
+
+        stallListOccupancy += numStalledTaintedInsts[tid];
+
+        // Only the instructions the ROB untainted since the last cycle
+        std::vector<DynInstPtr> &untainted = rob->getUntaintedStallInsts(tid);
+        for (auto &inst : untainted) {
+            // Squashed ones already left the stall list in doSquash()
+            if (!inst->isInStallList())
+                continue;
+
+            inst->removeFromStallList();
+            --numStalledTaintedInsts[tid];
+            addIfReady(inst);
         }
+        untainted.clear();
     }
 
     DPRINTF(IQ, "wakeUntaintInsts done.\n");
@@ -1271,24 +1425,8 @@ InstructionQueue<Impl>::getDeferredMemInstToExecute()
 {
     for (ListIt it = deferredMemInsts.begin(); it != deferredMemInsts.end();
          ++it) {
-        // [SafeSpec] we need to check the FenceDelay
-        // a load can be delayed due to
-        // 1. translation delay
-        // 2. virtual fence ahead
-        // 3. not ready to expose and gets a TLB miss
-        // for both (2, 3) we need to restart the translation
-        // Akk: removed code
-        if ( (*it)->translationCompleted() || (*it)->isSquashed()
-                || ((*it)->onlyWaitForFence() && !(*it)->fenceDelay())
-                ) {
+        if (isDeferredMemInstReady(*it)) {
             DynInstPtr mem_inst = *it;
-            assert(!(mem_inst->getDOPPDbg() && mem_inst->translationCompleted() && mem_inst->fenceDelay()));
-            // Akk[DOPP]: don't issue doppelganger after doppelganger translation completes
-            if ((mem_inst->fenceDelay() || mem_inst->isDOPPLoadExecuting()) && 
-                 mem_inst->hasDOPPTranslationCompleted() && !mem_inst->isSquashed()
-            ) {
-                continue;
-            }
             // Akk[DOPP]: If it is not doppelganger/doppelganger has finished executing - 
             if (!mem_inst->isDOPPLoadExecuting()){
                 mem_inst->onlyWaitForFence(false);
@@ -1302,6 +1440,28 @@ InstructionQueue<Impl>::getDeferredMemInstToExecute()
     return nullptr;
 }
 
+template <class Impl>
+bool
+InstructionQueue<Impl>::isDeferredMemInstReady(const DynInstPtr &mem_inst) const
+{
+    // [SafeSpec] we need to check the FenceDelay
+    // a load can be delayed due to
+    // 1. translation delay
+    // 2. virtual fence ahead
+    // 3. not ready to expose and gets a TLB miss
+    // for both (2, 3) we need to restart the translation
+    // Akk: removed code
+    if (!(mem_inst->translationCompleted() || mem_inst->isSquashed()
+          || (mem_inst->onlyWaitForFence() && !mem_inst->fenceDelay()))) {
+        return false;
+    }
+
+    assert(!(mem_inst->getDOPPDbg() && mem_inst->translationCompleted() && mem_inst->fenceDelay()));
+    // Akk[DOPP]: don't issue doppelganger after doppelganger translation completes
+    return !((mem_inst->fenceDelay() || mem_inst->isDOPPLoadExecuting()) &&
+             mem_inst->hasDOPPTranslationCompleted() && !mem_inst->isSquashed());
+}
+
 // Akk[DOPP2]: returns instructions for which the doppelganger has finished executing, and we can wake the dependents
 template <class Impl>
 typename Impl::DynInstPtr
@@ -1397,6 +1557,13 @@ InstructionQueue<Impl>::doSquash(ThreadID tid)
             DPRINTF(IQ, "[tid:%i]: Instruction [sn:%lli] PC %s squashed.\n",
                     tid, squashed_inst->seqNum, squashed_inst->pcState());
 
+            // [STT] drop it from the stall list; the ROB may still
+            // report it as untainted, wakeUntaintInsts() ignores it then
+            if (squashed_inst->isInStallList()) {
+                squashed_inst->removeFromStallList();
+                --numStalledTaintedInsts[tid];
+            }
+
             bool is_acq_rel = squashed_inst->isMemBarrier() &&
                          (squashed_inst->isLoad() ||
                            (squashed_inst->isStore() &&
@@ -1493,6 +1660,21 @@ InstructionQueue<Impl>::addToDependents(DynInstPtr &new_inst)
          src_reg_idx < total_src_regs;
          src_reg_idx++)
     {
+        // Akk[DOPP2] rename found the result of a producer that has been
+        // replayed since, wait for it to execute again
+        if (new_inst->isReadySrcRegIdx(src_reg_idx) &&
+            cpu->doppSelectiveReplay) {
+            DynInstPtr producer = new_inst->getArgProducer(src_reg_idx);
+            PhysRegIdPtr src_reg = new_inst->renamedSrcRegIdx(src_reg_idx);
+            if (producer && !producer->isMemRef() &&
+                !producer->isExecuted() && !src_reg->isFixedMapping()) {
+                new_inst->markSrcRegNotReady(src_reg_idx);
+                dependGraph.insert(src_reg->flatIndex(), new_inst);
+                return_val = true;
+            }
+            continue;
+        }
+
         // Only add it to the dependency graph if it's not ready.
         if (!new_inst->isReadySrcRegIdx(src_reg_idx)) {
             PhysRegIdPtr src_reg = new_inst->renamedSrcRegIdx(src_reg_idx);
@@ -1643,7 +1825,8 @@ InstructionQueue<Impl>::addIfReady(DynInstPtr &inst)
             if (!inst->isInStallList()) {
                 assert(!(inst->isLoad() || inst->isStore())); // stalled list should not contain loads/stores, is only for moreTransmitInsts
                 inst->addToStallList();
-                stalledTaintedInstList[inst->threadNumber].push_back(inst);
+                inst->taintStall(cpu->curCycle());
+                ++numStalledTaintedInsts[inst->threadNumber];
                 instsStalledBeforeSetReady++;
             }
         }
@@ -60,6 +60,7 @@ class LSQ {
     typedef typename Impl::O3CPU O3CPU;
     typedef typename Impl::DynInstPtr DynInstPtr;
     typedef typename Impl::CPUPol::IEW IEW;
+    typedef typename Impl::CPUPol::ROB ROB;
     typedef typename Impl::CPUPol::LSQUnit LSQUnit;
 
     /** SMT policy. */
@@ -84,10 +85,15 @@ class LSQ {
     /** Sets the pointer to the list of active threads. */
     void setActiveThreads(std::list<ThreadID> *at_ptr);
 
+    /** Sets the pointer to the ROB. */
+    void setROB(ROB *rob_ptr);
+
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
     /** Has the LSQ drained? */
     bool isDrained() const;
+    /** Is every active LSQ unit only waiting on the cache? */
+    bool isQuiescent();
     /** Takes over execution from another CPU's thread. */
     void takeOverFrom();
 
@@ -148,6 +148,14 @@ LSQ<Impl>::setActiveThreads(list<ThreadID> *at_ptr)
     assert(activeThreads != 0);
 }
 
+template<class Impl>
+void
+LSQ<Impl>::setROB(ROB *rob_ptr)
+{
+    for (ThreadID tid = 0; tid < numThreads; tid++)
+        thread[tid].setROB(rob_ptr);
+}
+
 template <class Impl>
 void
 LSQ<Impl>::drainSanityCheck() const
@@ -158,6 +166,18 @@ LSQ<Impl>::drainSanityCheck() const
         thread[tid].drainSanityCheck();
 }
 
+template <class Impl>
+bool
+LSQ<Impl>::isQuiescent()
+{
+    for (auto tid : *activeThreads) {
+        if (!thread[tid].isQuiescent())
+            return false;
+    }
+
+    return true;
+}
+
 template <class Impl>
 bool
 LSQ<Impl>::isDrained() const
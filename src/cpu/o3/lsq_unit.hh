@@ -56,6 +56,8 @@
 #include "arch/mmapped_ipr.hh"
 #include "config/the_isa.hh"
 #include "cpu/inst_seq.hh"
+#include "cpu/o3/dopp_data_pool.hh"
+#include "cpu/o3/dopp_pc_stats.hh"
 #include "cpu/timebuf.hh"
 #include "debug/LSQUnit.hh"
 #include "debug/JY.hh"
@@ -83,6 +85,7 @@ class LSQUnit {
     typedef typename Impl::DynInstPtr DynInstPtr;
     typedef typename Impl::CPUPol::IEW IEW;
     typedef typename Impl::CPUPol::LSQ LSQ;
+    typedef typename Impl::CPUPol::ROB ROB;
     typedef typename Impl::CPUPol::IssueStruct IssueStruct;
 
   public:
@@ -103,9 +106,18 @@ class LSQUnit {
     /** Sets the pointer to the dcache port. */
     void setDcachePort(MasterPort *dcache_port);
 
+    /** Sets the pointer to the ROB. */
+    void setROB(ROB *rob_ptr) { rob = rob_ptr; }
+
     /** Perform sanity checks after a drain. */
     void drainSanityCheck() const;
 
+    /**
+     * Returns true if the unit has no store it could write back without
+     * a response or a retry from the cache.
+     */
+    bool isQuiescent();
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
@@ -152,9 +164,18 @@ class LSQUnit {
 
     /** Commits the head load. */
     void commitLoad();
+    /** [STT] Tell the commit listeners about a speculative access. */
+    void notifyCommittedAccess(const DynInstPtr &inst);
     /** Commits loads older than a specific sequence number. */
     void commitLoads(InstSeqNum &youngest_inst);
 
+    // Akk[DOPP]
+    /** Points the doppelganger buffers of a load at its pool buffer.
+     *  @return false if no buffer is available. */
+    bool acquireDoppBuf(int load_idx);
+    /** Returns the pool buffer of a load leaving the load queue. */
+    void releaseDoppBuf(int load_idx);
+
     /** Commits stores older than a specific sequence number. */
     void commitStores(InstSeqNum &youngest_inst);
 
@@ -167,9 +188,14 @@ class LSQUnit {
     /** [mengjia] Update Visbible State.
      * In the mode defence relying on fence: setup fenceDelay state.
      * In the mode defence relying on invisibleSpec:
-     * setup readyToExpose*/
+     * setup readyToExpose
+     * Only the loads the ROB reported are updated, except without STT
+     * under Futuristic, where the whole load queue is walked. */
     void updateVisibleState();
 
+    /** Sets up fenceDelay and readyToExpose of one load. */
+    void updateVisibleState(const DynInstPtr &inst);
+
     /** Completes the data access that has been returned from the
      * memory system. */
     void completeDataAccess(PacketPtr pkt);
@@ -300,6 +326,9 @@ class LSQUnit {
     /** Pointer to the LSQ. */
     LSQ *lsq;
 
+    /** Pointer to the ROB, which reports loads to updateVisibleState(). */
+    ROB *rob;
+
     /** Pointer to the dcache port.  Used only for sending. */
     MasterPort *dcachePort;
 
@@ -311,7 +340,7 @@ class LSQUnit {
         LSQSenderState()
             : mainPkt(NULL), pendingPacket(NULL), idx(0), outstanding(1),
               isLoad(false), noWB(false), isSplit(false),
-              pktToSend(false), cacheBlocked(false)
+              pktToSend(false), cacheBlocked(false), doppBuf(-1)
           { }
 
         /** Instruction who initiated the access to memory. */
@@ -334,6 +363,8 @@ class LSQUnit {
         bool pktToSend;
         /** Whether or not the second packet of this split load was blocked */
         bool cacheBlocked;
+        /** Akk[DOPP]: pool buffer the doppelganger data is written to. */
+        int doppBuf;
 
         /** Completes a packet and returns whether the access is finished. */
         inline bool complete() { return --outstanding == 0; }
@@ -421,6 +452,9 @@ class LSQUnit {
     /** The load queue. */
     std::vector<DynInstPtr> loadQueue;
 
+    /** Akk[DOPP]: data buffers of the doppelganger loads, per LQ slot. */
+    DoppDataPool doppPool;
+
     /** The number of LQ entries, plus a sentinel entry (circular queue).
      *  @todo: Consider having var that records the true number of LQ entries.
      */
@@ -552,6 +586,26 @@ class LSQUnit {
     Stats::Scalar numExposes;
     Stats::Scalar numConvertedExposes;
 
+    // Akk[DOPP]
+    /** Doppelganger loads that returned data without a fault. */
+    Stats::Scalar doppCompleted;
+    /** Real loads whose doppelganger used the right address. */
+    Stats::Scalar doppPredHits;
+    /** Real loads whose doppelganger used a wrong address. */
+    Stats::Scalar doppPredMisses;
+    /** Fraction of verified doppelganger addresses that were right. */
+    Stats::Formula doppPredAccuracy;
+    /** Doppelganger loads that had data forwarded from stores. */
+    Stats::Scalar doppStFwd;
+    /** Doppelganger loads dropped on a partial store-forward. */
+    Stats::Scalar doppKilled;
+    /** Doppelganger loads dropped because the cache was blocked. */
+    Stats::Scalar doppBlocked;
+    /** Doppelganger loads dropped on a translation fault. */
+    Stats::Scalar doppFaulted;
+    /** Doppelganger loads dropped for lack of a data buffer. */
+    Stats::Scalar doppNoBuffer;
+
 
   public:
     void print_lsq() const;
@@ -632,6 +686,23 @@ LSQUnit<Impl>::read(Request *req, Request *sreqLow, Request *sreqHigh,
             load_inst->seqNum, load_inst->pcState());
     }
 
+    // Akk[DOPP]: doppelganger data goes to the pool buffer of the LQ slot
+    if (load_inst->isDOPPLoadExecuting() && !acquireDoppBuf(load_idx)) {
+        load_inst->isDOPPLoadExecuting(false);
+        load_inst->isDOPPLoadSuccess(false);
+        load_inst->hasDOPPFinished(true);
+        load_inst->resetDOPP();
+        ++doppNoBuffer;
+
+        delete req;
+        if (TheISA::HasUnalignedMemAcc && sreqLow) {
+            delete sreqLow;
+            delete sreqHigh;
+        }
+
+        return NoFault;
+    }
+
     // Check the SQ for any previous stores that might lead to forwarding
     // why we have store queue index for a load operation? [mengjia]
     // load_inst->sqIdx is the youngest store in store queue when load is inserted in load queue
@@ -742,11 +813,7 @@ LSQUnit<Impl>::read(Request *req, Request *sreqLow, Request *sreqHigh,
             if (cpu->DOPP && load_inst->isDOPPLoadExecuting()){
                 int shift_amt = req->getVaddr() - storeQueue[store_idx].inst->effAddr;
 
-                // Allocate memory if this is the first time a load is issued.
-                if (!load_inst->doppStFwdData) {
-                    load_inst->doppStFwdData = new uint8_t[req->getSize()];
-                    load_inst->doppStFwdDataSize = req->getSize();
-                }
+                load_inst->doppStFwdDataSize = req->getSize();
                 if (storeQueue[store_idx].isAllZeros)
                     memset(load_inst->doppStFwdData, 0, req->getSize());
                 else
@@ -758,6 +825,9 @@ LSQUnit<Impl>::read(Request *req, Request *sreqLow, Request *sreqHigh,
                 DPRINTF(LSQUnit, "Still need dummy load to hide tainted address of store");
 
                 load_inst->DOPPAlreadyForwarded = true;
+                ++doppStFwd;
+                iewStage->doppPCStats.record(load_inst->instAddr(),
+                                             DoppPCStats::StoreForwarded);
 
                 break;
             }
@@ -846,6 +916,9 @@ LSQUnit<Impl>::read(Request *req, Request *sreqLow, Request *sreqHigh,
                 load_inst->isDOPPLoadSuccess(false);
                 load_inst->hasDOPPFinished(true);
                 load_inst->resetDOPP();
+                ++doppKilled;
+                iewStage->doppPCStats.record(load_inst->instAddr(),
+                                             DoppPCStats::Killed);
 
                 delete req;
                 if (TheISA::HasUnalignedMemAcc && sreqLow) {
@@ -905,11 +978,6 @@ LSQUnit<Impl>::read(Request *req, Request *sreqLow, Request *sreqHigh,
     if (!load_inst->memData) {
         load_inst->memData = new uint8_t[req->getSize()];
     }
-    // Akk[DOPP]: allocate memory for doppelganger load
-    if (!load_inst->doppMemData) {
-        load_inst->doppMemData = new uint8_t[req->getSize()];
-    }
-
     // Akk[DOPP]: use data from doppelganger load if it is successful and the predicted address is correct.
     // assert(load_inst->isDOPPPredCorrect());
     if (load_inst->isDOPPPredCorrect() && load_inst->isDOPPLoadSuccess()){
@@ -1026,6 +1094,14 @@ LSQUnit<Impl>::read(Request *req, Request *sreqLow, Request *sreqHigh,
         }
     }
 
+    // Akk[DOPP]: the response is written straight into the pool buffer,
+    // keep it pinned until it is back
+    if (load_inst->isDOPPLoadExecuting() &&
+        (successful_load || completedFirst)) {
+        state->doppBuf = doppPool.bufferOf(load_idx);
+        doppPool.pin(state->doppBuf);
+    }
+
     // If the cache was blocked, or has become blocked due to the access,
     // handle it.
     if (!successful_load) {
@@ -1067,6 +1143,9 @@ LSQUnit<Impl>::read(Request *req, Request *sreqLow, Request *sreqHigh,
                 load_inst->isDOPPLoadSuccess(false);
                 load_inst->hasDOPPFinished(true);
                 load_inst->resetDOPP();
+                ++doppBlocked;
+                iewStage->doppPCStats.record(load_inst->instAddr(),
+                                             DoppPCStats::Blocked);
             }
             load_inst->DOPPAlreadyForwarded = false;
         }
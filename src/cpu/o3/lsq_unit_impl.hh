@@ -109,18 +109,26 @@ LSQUnit<Impl>::completeDataAccess(PacketPtr pkt)
         // where the 2nd half blocked, ignore this response
         DPRINTF(IEW, "[sn:%lli]: Response from first half of earlier "
             "blocked split load recieved. Ignoring.\n", inst->seqNum);
-            delete state;
+        if (state->doppBuf >= 0)
+            doppPool.unpin(state->doppBuf);
+        delete state;
         // Akk[DOPP]: if this corresponds to a doppelganger load, then set doppelganger success to false
         if (cpu->DOPP && inst->isDOPPLoadExecuting()){
             inst->isDOPPLoadExecuting(false);
             inst->isDOPPLoadSuccess(false);
             inst->hasDOPPFinished(true);
             inst->resetDOPP();
+            ++doppBlocked;
+            iewStage->doppPCStats.record(inst->instAddr(),
+                                         DoppPCStats::Blocked);
         }
         return;
     }
 
     assert(!pkt->isSpec());
+    // [STT] the prefetcher trains on the access once the load commits
+    if (pkt->isTrainDeferred())
+        inst->isTrainDeferred(true);
     // need to update hit info for corresponding instruction
     // Akk: removed code, isSpec
     // Akk: removed code, setSpecBuff
@@ -167,7 +175,11 @@ LSQUnit<Impl>::completeDataAccess(PacketPtr pkt)
 
     // Akk: removed code
     assert(!pkt->isExpose() && !pkt->isValidate());
-    
+
+    // Akk[DOPP]
+    if (state->doppBuf >= 0)
+        doppPool.unpin(state->doppBuf);
+
     delete state;
 }
 
@@ -190,6 +202,8 @@ LSQUnit<Impl>::init(O3CPU *cpu_ptr, IEW *iew_ptr, DerivO3CPUParams *params,
 
     lsq = lsq_ptr;
 
+    rob = NULL;
+
     lsqID = id;
 
     DPRINTF(LSQUnit, "Creating LSQUnit%i object.\n",id);
@@ -205,6 +219,8 @@ LSQUnit<Impl>::init(O3CPU *cpu_ptr, IEW *iew_ptr, DerivO3CPUParams *params,
     loadQueue.resize(LQEntries);
     storeQueue.resize(SQEntries);
 
+    doppPool.init(LQEntries, cpu->cacheLineSize());
+
     depCheckShift = params->LSQDepCheckShift;
     checkLoads = params->LSQCheckLoads;
     cacheStorePorts = params->cacheStorePorts;
@@ -313,6 +329,44 @@ LSQUnit<Impl>::regStats()
         .name(name() + ".numConvertedExposes")
         .desc("Number of exposes converted from validation");
 
+    // Akk[DOPP]
+    doppCompleted
+        .name(name() + ".doppCompleted")
+        .desc("Number of doppelganger loads that returned data");
+
+    doppPredHits
+        .name(name() + ".doppPredHits")
+        .desc("Number of loads whose doppelganger address was right");
+
+    doppPredMisses
+        .name(name() + ".doppPredMisses")
+        .desc("Number of loads whose doppelganger address was wrong");
+
+    doppPredAccuracy
+        .name(name() + ".doppPredAccuracy")
+        .desc("Fraction of verified doppelganger addresses that were right");
+    doppPredAccuracy = doppPredHits / (doppPredHits + doppPredMisses);
+
+    doppStFwd
+        .name(name() + ".doppStFwd")
+        .desc("Number of doppelganger loads forwarded from stores");
+
+    doppKilled
+        .name(name() + ".doppKilled")
+        .desc("Number of doppelganger loads killed by partial forwarding");
+
+    doppBlocked
+        .name(name() + ".doppBlocked")
+        .desc("Number of doppelganger loads dropped on a blocked cache");
+
+    doppFaulted
+        .name(name() + ".doppFaulted")
+        .desc("Number of doppelganger loads dropped on a translation fault");
+
+    doppNoBuffer
+        .name(name() + ".doppNoBuffer")
+        .desc("Number of doppelganger loads dropped for lack of a buffer");
+
 }
 
 template<class Impl>
@@ -348,6 +402,18 @@ LSQUnit<Impl>::drainSanityCheck() const
     assert(!retryPkt);
 }
 
+template<class Impl>
+bool
+LSQUnit<Impl>::isQuiescent()
+{
+    if (hasPendingPkt || isStoreBlocked)
+        return false;
+
+    // Mirrors the condition writebackStores() sends the next store on
+    return !(storesToWB > 0 && storeWBIdx != storeTail && willWB() &&
+             (!cpu->needsTSO || !storeInFlight));
+}
+
 template<class Impl>
 void
 LSQUnit<Impl>::takeOverFrom()
@@ -373,6 +439,8 @@ LSQUnit<Impl>::resizeLQ(unsigned size)
     }
 
     assert(LQEntries <= 256);
+
+    doppPool.init(LQEntries, cpu->cacheLineSize());
 }
 
 template<class Impl>
@@ -434,6 +502,9 @@ LSQUnit<Impl>::insertLoad(DynInstPtr &load_inst)
 
     ++loads;
 
+    // later changes are reported by the ROB
+    updateVisibleState(load_inst);
+
 }
 
 template <class Impl>
@@ -761,6 +832,9 @@ LSQUnit<Impl>::executeLoad(DynInstPtr &inst)
             inst->hasDOPPTranslationCompleted(false);
             inst->resetDOPP();
             inst->setDOPPDbg(true);
+            ++doppFaulted;
+            iewStage->doppPCStats.record(inst->instAddr(),
+                                         DoppPCStats::Faulted);
             return load_fault;
         }
         else if (inst->translationCompleted()){
@@ -875,6 +949,36 @@ LSQUnit<Impl>::executeStore(DynInstPtr &store_inst)
 
 }
 
+// Akk[DOPP]
+template <class Impl>
+bool
+LSQUnit<Impl>::acquireDoppBuf(int load_idx)
+{
+    DynInstPtr &load_inst = loadQueue[load_idx];
+
+    int buf = doppPool.acquire(load_idx);
+    if (buf < 0)
+        return false;
+
+    assert(load_inst->effSize <= doppPool.bufferSize());
+    load_inst->doppMemData = doppPool.data(buf);
+    load_inst->doppStFwdData = doppPool.stFwdData(buf);
+    return true;
+}
+
+template <class Impl>
+void
+LSQUnit<Impl>::releaseDoppBuf(int load_idx)
+{
+    DynInstPtr &load_inst = loadQueue[load_idx];
+
+    // The instruction may outlive its slot, do not leave it pointing into
+    // a buffer that is handed to the next load.
+    load_inst->doppMemData = NULL;
+    load_inst->doppStFwdData = NULL;
+    doppPool.release(load_idx);
+}
+
 template <class Impl>
 void
 LSQUnit<Impl>::commitLoad()
@@ -884,6 +988,10 @@ LSQUnit<Impl>::commitLoad()
     DPRINTF(LSQUnit, "Committing head load instruction, PC %s\n",
             loadQueue[loadHead]->pcState());
 
+    if (cpu->ppCommittedLoadAccess->hasListeners())
+        notifyCommittedAccess(loadQueue[loadHead]);
+
+    releaseDoppBuf(loadHead);
     loadQueue[loadHead] = NULL;
 
     incrLdIdx(loadHead);
@@ -891,6 +999,29 @@ LSQUnit<Impl>::commitLoad()
     --loads;
 }
 
+template <class Impl>
+void
+LSQUnit<Impl>::notifyCommittedAccess(const DynInstPtr &inst)
+{
+    // only the loads whose speculative access the prefetcher would have
+    // trained on, i.e. a miss or a hit on a prefetched block, within a
+    // line
+    unsigned line_size = cpu->cacheLineSize();
+    if (!inst->effAddrValid() || inst->fault != NoFault ||
+        !inst->isTrainDeferred() || inst->strictlyOrdered() ||
+        (inst->effAddr % line_size) + inst->effSize > line_size)
+        return;
+
+    Request req(inst->asid, inst->effAddr, inst->effSize, inst->memReqFlags,
+                inst->masterId(), inst->instAddr(), inst->contextId());
+    req.setPaddr(inst->physEffAddrLow);
+    Packet pkt(&req, MemCmd::ReadReq);
+    if (inst->memData)
+        pkt.dataStatic(inst->memData);
+
+    cpu->ppCommittedLoadAccess->notify(&pkt);
+}
+
 template <class Impl>
 void
 LSQUnit<Impl>::commitLoads(InstSeqNum &youngest_inst)
@@ -959,48 +1090,68 @@ template <class Impl>
 void
 LSQUnit<Impl>::updateVisibleState()
 {
-    int load_idx = loadHead;
-
-    //iterate all the loads and update its fencedelay state accordingly
-    while (load_idx != loadTail && loadQueue[load_idx]){
-        DynInstPtr inst = loadQueue[load_idx];
+    std::vector<DynInstPtr> &changed = rob->getVisibleStateLoads(lsqID);
+
+    if (cpu->protectionEnabled && !cpu->STT && cpu->isFuturistic) {
+        // Not incremental: without STT the Futuristic fence waits for
+        // PrevInstsCompleted, which only the ROB's full walk keeps and
+        // which it does not report per load, so every load in the LQ is
+        // rechecked each cycle as before
+        int load_idx = loadHead;
+
+        //iterate all the loads and update its fencedelay state accordingly
+        while (load_idx != loadTail && loadQueue[load_idx]){
+            updateVisibleState(loadQueue[load_idx]);
+            incrLdIdx(load_idx);
+        }
+    } else {
+        // Loads were set up in insertLoad(), only update the ones whose
+        // taint or older branches changed since
+        for (auto &inst : changed) {
+            if (!inst->isSquashed())
+                updateVisibleState(inst);
+        }
+    }
+    changed.clear();
+}
 
-        if (cpu->protectionEnabled && !cpu->isInvisibleSpec) {
-            // fence (fenceDelay flag is effective)
-            if (cpu->STT) {
-                inst->fenceDelay(inst->isArgsTainted());
-            }
-            else {
-                // !applySTT, if delay fence when fence is squashable
-                if ( (cpu->isFuturistic && inst->isPrevInstsCompleted()) || // (cpu->isFuturistic && inst->isPrevInstsCommitted()) ||
-                        (!cpu->isFuturistic && inst->isPrevBrsResolved())){ // (!cpu->isFuturistic && inst->isPrevBrsCommitted())){
-                    // here prior instructions are committed so inst is unsquashable
-                    if (inst->fenceDelay()){
-                        DPRINTF(LSQUnit, "Clear virtual fence for "
-                                "inst [sn:%lli] PC %s\n", inst->seqNum, inst->pcState());
-                    }
-                    inst->fenceDelay(false);
-                } else {
-                    // here prior instructions are not committed so inst is squashable
-                    if (!inst->fenceDelay()){
-                        DPRINTF(LSQUnit, "Deffering an inst [sn:%lli] PC %s"
-                                " due to virtual fence\n",inst->seqNum, inst->pcState());
-                    }
-                    inst->fenceDelay(true);
+template <class Impl>
+void
+LSQUnit<Impl>::updateVisibleState(const DynInstPtr &inst)
+{
+    if (cpu->protectionEnabled && !cpu->isInvisibleSpec) {
+        // fence (fenceDelay flag is effective)
+        if (cpu->STT) {
+            inst->fenceDelay(inst->isArgsTainted());
+        }
+        else {
+            // !applySTT, if delay fence when fence is squashable
+            if ( (cpu->isFuturistic && inst->isPrevInstsCompleted()) || // (cpu->isFuturistic && inst->isPrevInstsCommitted()) ||
+                    (!cpu->isFuturistic && inst->isPrevBrsResolved())){ // (!cpu->isFuturistic && inst->isPrevBrsCommitted())){
+                // here prior instructions are committed so inst is unsquashable
+                if (inst->fenceDelay()){
+                    DPRINTF(LSQUnit, "Clear virtual fence for "
+                            "inst [sn:%lli] PC %s\n", inst->seqNum, inst->pcState());
+                }
+                inst->fenceDelay(false);
+            } else {
+                // here prior instructions are not committed so inst is squashable
+                if (!inst->fenceDelay()){
+                    DPRINTF(LSQUnit, "Deffering an inst [sn:%lli] PC %s"
+                            " due to virtual fence\n",inst->seqNum, inst->pcState());
                 }
+                inst->fenceDelay(true);
             }
-            inst->readyToExpose(true);
-        } else if (cpu->protectionEnabled && cpu->isInvisibleSpec){
-            assert (0); // not supported
-            // Akk: removed code
-        } else {
-            // unsafe
-            inst->readyToExpose(true);
-            inst->isUnsquashable(true);
-            inst->fenceDelay(false);
         }
-
-        incrLdIdx(load_idx);
+        inst->readyToExpose(true);
+    } else if (cpu->protectionEnabled && cpu->isInvisibleSpec){
+        assert (0); // not supported
+        // Akk: removed code
+    } else {
+        // unsafe
+        inst->readyToExpose(true);
+        inst->isUnsquashable(true);
+        inst->fenceDelay(false);
     }
 }
 
@@ -1273,6 +1424,7 @@ LSQUnit<Impl>::squash(const InstSeqNum &squashed_num)
 
         // Clear the smart pointer to make sure it is decremented.
         loadQueue[load_idx]->setSquashed();
+        releaseDoppBuf(load_idx);
         loadQueue[load_idx] = NULL;
         --loads;
 
@@ -1416,9 +1568,6 @@ LSQUnit<Impl>::writeback(DynInstPtr &inst, PacketPtr pkt)
                 if (inst->DOPPAlreadyForwarded){
                     assert(cpu->STT && cpu->impChannel && cpu->DOPP);
                     memcpy(inst->doppMemData, inst->doppStFwdData, inst->doppStFwdDataSize);
-                    // Akk[DOPP]: TODO: free the memory in the destructor
-                    delete[] inst->doppStFwdData;
-                    inst->doppStFwdData = NULL;
                 }
                 // Akk[DOPP2]: since load is being propagated, we need to write value to the registers
                 inst->completeAcc(pkt);
@@ -1468,6 +1617,17 @@ LSQUnit<Impl>::writeback(DynInstPtr &inst, PacketPtr pkt)
     if (!inst->isDOPPLoadExecuting()){
         iewStage->checkMisprediction(inst);
         // Akk[DOPP2]
+        if (inst->isDOPPLoadSuccess()) {
+            if (inst->isDOPPPredCorrect()) {
+                ++doppPredHits;
+                iewStage->doppPCStats.record(inst->instAddr(),
+                                             DoppPCStats::PredHit);
+            } else {
+                ++doppPredMisses;
+                iewStage->doppPCStats.record(inst->instAddr(),
+                                             DoppPCStats::PredMiss);
+            }
+        }
         iewStage->checkDOPPMisprediction(inst);
     }
 
@@ -1479,6 +1639,11 @@ LSQUnit<Impl>::writeback(DynInstPtr &inst, PacketPtr pkt)
         inst->resetDOPP();
         // Akk[DOPP2]
         inst->doppShouldWakeDependents(inst->isDOPPLoadSuccess());
+        if (inst->isDOPPLoadSuccess()) {
+            ++doppCompleted;
+            iewStage->doppPCStats.record(inst->instAddr(),
+                                         DoppPCStats::Completed);
+        }
     }
 }
 
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_PC_STATS_TABLE_HH__
+#define __CPU_O3_PC_STATS_TABLE_HH__
+
+#include <algorithm>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "base/output.hh"
+#include "base/types.hh"
+#include "sim/core.hh"
+
+/**
+ * A table of per static PC stats, of which only the top-N PCs are
+ * written out, to <name>.txt in the output directory, every time the
+ * stats are dumped. The owner registers dump() and reset() as stats
+ * callbacks; the table is cleared when the stats are reset.
+ *
+ * An Entry is default constructible and provides:
+ *  - Counter rank() const, the order the PCs are dumped in (highest
+ *    first, ties broken by PC to keep dumps deterministic);
+ *  - static void printHeader(std::ostream &os), the column names after
+ *    the pc column;
+ *  - void print(std::ostream &os) const, its columns of one row.
+ */
+template <class Entry>
+class PCStatsTable
+{
+  public:
+    /**
+     * @param name Name of the table and of its output file.
+     * @param top_n Number of PCs dumped, 0 disables the table.
+     */
+    PCStatsTable(const std::string &name, unsigned top_n)
+        : _name(name), topN(top_n), stream(NULL)
+    {
+    }
+
+    /** Whether anything is recorded at all. */
+    bool enabled() const { return topN; }
+
+    /** The entry of the instruction at pc, created empty. */
+    Entry &operator[](Addr pc) { return table[pc]; }
+
+    /** Writes the top-N PCs, called back on a stats dump. */
+    void dump();
+
+    /** Clears the table, called back on a stats reset. */
+    void reset() { table.clear(); }
+
+  private:
+    const std::string _name;
+
+    const unsigned topN;
+
+    std::unordered_map<Addr, Entry> table;
+
+    /** Output file, created on the first dump. */
+    OutputStream *stream;
+};
+
+template <class Entry>
+void
+PCStatsTable<Entry>::dump()
+{
+    if (!topN)
+        return;
+
+    if (!stream)
+        stream = simout.create(_name + ".txt");
+
+    typedef std::pair<Addr, const Entry *> Row;
+    std::vector<Row> rows;
+    rows.reserve(table.size());
+    for (const auto &entry : table)
+        rows.emplace_back(entry.first, &entry.second);
+
+    auto order = [](const Row &a, const Row &b) {
+        if (a.second->rank() != b.second->rank())
+            return a.second->rank() > b.second->rank();
+        return a.first < b.first;
+    };
+    size_t n = std::min<size_t>(topN, rows.size());
+    std::partial_sort(rows.begin(), rows.begin() + n, rows.end(), order);
+
+    std::ostream &os = *stream->stream();
+    ccprintf(os, "---------- Begin %s at tick %d (%d of %d PCs) ----------\n",
+             _name, curTick(), n, rows.size());
+    ccprintf(os, "%-18s", "pc");
+    Entry::printHeader(os);
+    ccprintf(os, "\n");
+
+    for (size_t i = 0; i < n; ++i) {
+        ccprintf(os, "%#-18x", rows[i].first);
+        rows[i].second->print(os);
+        ccprintf(os, "\n");
+    }
+    ccprintf(os, "---------- End %s ----------\n\n", _name);
+    os.flush();
+}
+
+#endif // __CPU_O3_PC_STATS_TABLE_HH__
@@ -46,6 +46,7 @@
 
 #include <list>
 #include <utility>
+#include <vector>
 
 #include "base/statistics.hh"
 #include "config/the_isa.hh"
@@ -187,6 +188,15 @@ class DefaultRename
     /** Has the stage drained? */
     bool isDrained() const;
 
+    /**
+     * Is rename stalled by a full back end, or idle with nothing coming
+     * from decode?
+     */
+    bool isQuiescent();
+
+    /** Counts skipped cycles as blocked or idle rename cycles. */
+    void skipCycles(Cycles cycles);
+
     /** Takes over from another CPU's thread. */
     void takeOverFrom();
 
@@ -257,6 +267,9 @@ class DefaultRename
     /** Renames the destination registers of an instruction. */
     inline void renameDestRegs(DynInstPtr &inst, ThreadID tid);
 
+    /** [STT] Returns the regProducers entry of a physical register. */
+    inline DynInstPtr &regProducer(PhysRegIdPtr phys_reg);
+
     /** Calculates the number of free ROB entries for a specific thread. */
     inline int calcFreeROBEntries(ThreadID tid);
 
@@ -315,6 +328,9 @@ class DefaultRename
         /** The old physical register that the arch. register was renamed to.
          */
         PhysRegIdPtr prevPhysReg;
+        /** [STT] The producer of the new physical register before the
+         *  instruction, restored if it is squashed. */
+        DynInstPtr prevProducer;
     };
 
     /** A per-thread list of all destination register renames, used to either
@@ -322,6 +338,14 @@ class DefaultRename
      */
     std::list<RenameHistory> historyBuffer[Impl::MaxThreads];
 
+    /** [STT] The youngest uncommitted instruction writing each physical
+     *  register, indexed by flat index (misc registers by their index in
+     *  miscRegProducers, since they all share flat index 0).  Used to link
+     *  an instruction to its argProducers when its sources are renamed.
+     */
+    std::vector<DynInstPtr> regProducers;
+    std::vector<DynInstPtr> miscRegProducers;
+
     /** Pointer to CPU. */
     O3CPU *cpu;
 
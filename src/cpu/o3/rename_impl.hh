@@ -266,6 +266,9 @@ DefaultRename<Impl>::resetStage()
 
         serializeOnNextInst[tid] = false;
     }
+
+    regProducers.clear();
+    miscRegProducers.clear();
 }
 
 template<class Impl>
@@ -313,6 +316,41 @@ DefaultRename<Impl>::isDrained() const
     return true;
 }
 
+template <class Impl>
+bool
+DefaultRename<Impl>::isQuiescent()
+{
+    if (resumeSerialize || resumeUnblocking)
+        return false;
+
+    for (auto tid : *activeThreads) {
+        if (!insts[tid].empty())
+            return false;
+
+        if (renameStatus[tid] == Blocked) {
+            if (!checkStall(tid))
+                return false;
+        } else if ((renameStatus[tid] != Running &&
+                    renameStatus[tid] != Idle) || checkStall(tid)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+template <class Impl>
+void
+DefaultRename<Impl>::skipCycles(Cycles cycles)
+{
+    for (auto tid : *activeThreads) {
+        if (renameStatus[tid] == Blocked)
+            renameBlockCycles += cycles;
+        else
+            renameIdleCycles += cycles;
+    }
+}
+
 template <class Impl>
 void
 DefaultRename<Impl>::takeOverFrom()
@@ -956,6 +994,12 @@ DefaultRename<Impl>::doSquash(const InstSeqNum &squashed_seq_num, ThreadID tid)
             freeList->addReg(hb_it->newPhysReg);
         }
 
+        // [STT] Hand the register back to the producer it had before
+        DynInstPtr &producer = regProducer(hb_it->newPhysReg);
+        if (producer && producer->seqNum == hb_it->instSeqNum) {
+            producer = hb_it->prevProducer;
+        }
+
         // Notify potential listeners that the register mapping needs to be
         // removed because the instruction it was mapped to got squashed. Note
         // that this is done before hb_it is incremented.
@@ -1011,6 +1055,12 @@ DefaultRename<Impl>::removeFromHistory(InstSeqNum inst_seq_num, ThreadID tid)
             freeList->addReg(hb_it->prevPhysReg);
         }
 
+        // [STT] Drop the committed producer unless a younger one took over
+        DynInstPtr &producer = regProducer(hb_it->newPhysReg);
+        if (producer && producer->seqNum == hb_it->instSeqNum) {
+            producer = NULL;
+        }
+
         ++renameCommittedMaps;
 
         historyBuffer[tid].erase(hb_it--);
@@ -1058,6 +1108,15 @@ DefaultRename<Impl>::renameSrcRegs(DynInstPtr &inst, ThreadID tid)
 
         inst->renameSrcReg(src_idx, renamed_reg);
 
+        /*** [STT] link the producer of this source, if still in flight.
+         *   The zero register cannot be tainted. ***/
+        if (cpu->STT && src_reg.index() != 16) {
+            DynInstPtr &producer = regProducer(renamed_reg);
+            if (producer && !producer->isCommitted()) {
+                inst->setArgProducer(src_idx, producer);
+            }
+        }
+
         // See if the register is ready or not.
         if (scoreboard->getReg(renamed_reg)) {
             DPRINTF(Rename, "[tid:%u]: Register %d (flat: %d) (%s)"
@@ -1109,6 +1168,9 @@ DefaultRename<Impl>::renameDestRegs(DynInstPtr &inst, ThreadID tid)
         RenameHistory hb_entry(inst->seqNum, flat_dest_regid,
                                rename_result.first,
                                rename_result.second);
+        if (cpu->STT) {
+            hb_entry.prevProducer = regProducer(rename_result.first);
+        }
 
         historyBuffer[tid].push_front(hb_entry);
 
@@ -1126,10 +1188,30 @@ DefaultRename<Impl>::renameDestRegs(DynInstPtr &inst, ThreadID tid)
                             rename_result.first,
                             rename_result.second);
 
+        // [STT] This instruction now produces the physical register
+        if (cpu->STT) {
+            regProducer(rename_result.first) = inst;
+        }
+
         ++renameRenamedOperands;
     }
 }
 
+template <class Impl>
+inline typename Impl::DynInstPtr &
+DefaultRename<Impl>::regProducer(PhysRegIdPtr phys_reg)
+{
+    std::vector<DynInstPtr> &producers =
+        phys_reg->isMiscReg() ? miscRegProducers : regProducers;
+    RegIndex idx =
+        phys_reg->isMiscReg() ? phys_reg->index() : phys_reg->flatIndex();
+
+    if (idx >= producers.size())
+        producers.resize(idx + 1);
+
+    return producers[idx];
+}
+
 template <class Impl>
 inline int
 DefaultRename<Impl>::calcFreeROBEntries(ThreadID tid)
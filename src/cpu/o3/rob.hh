@@ -44,13 +44,18 @@
 #ifndef __CPU_O3_ROB_HH__
 #define __CPU_O3_ROB_HH__
 
+#include <map>
+#include <set>
 #include <string>
 #include <utility>
 #include <vector>
 
 #include "arch/registers.hh"
+#include "base/statistics.hh"
 #include "base/types.hh"
 #include "config/the_isa.hh"
+#include "cpu/o3/taint_pc_stats.hh"
+#include "cpu/o3/taint_vector.hh"
 
 struct DerivO3CPUParams;
 
@@ -83,6 +88,13 @@ class ROB
         Threshold
     };
 
+    /** [STT] Taint propagation engine */
+    enum TaintEngine {
+        FullTaint,          // re-walk the whole ROB every cycle
+        IncrementalTaint,   // only re-evaluate instructions whose inputs changed
+        BitVectorTaint      // propagate over per-slot bit vectors, 64 at a time
+    };
+
   private:
     /** Per-thread ROB status. */   // This is never used actually
     Status robStatus[Impl::MaxThreads];
@@ -90,6 +102,13 @@ class ROB
     /** ROB resource sharing policy for SMT mode. */
     ROBPolicy robPolicy;
 
+    /** [STT] Taint propagation engine used by compute_taint(). */
+    TaintEngine taintEngine;
+
+    /** [STT] Whether to run the full engine after the selected one and
+     *  panic if their taint decisions differ. */
+    bool checkTaint;
+
   public:
     /** ROB constructor.
      *  @param _cpu   The cpu object pointer.
@@ -163,6 +182,23 @@ class ROB
     /** Is there any commitable head instruction across all threads ready. */
     bool canCommit();
 
+    /**
+     * Is a thread's ROB waiting on its head without anything left for the
+     * IQ or the LSQ to pick up? Unlike isHeadReady(), this is not counted
+     * as a ROB read.
+     */
+    bool isQuiescent(ThreadID tid) const;
+
+    /** Counts the head polls commit would have made in skipped cycles. */
+    void skipCycles(Cycles cycles)
+    {
+        robReads += cycles;
+        occupancy += numInstsInROB * cycles;
+    }
+
+    /** Accumulates the instructions in the ROB, once per cycle. */
+    void sampleOccupancy() { occupancy += numInstsInROB; }
+
     /** Re-adjust ROB partitioning. */
     void resetEntries();
 
@@ -279,8 +315,8 @@ class ROB
     // depends on explicit_flow() and implicit_flow()
     void compute_taint();
 
-    // compute the number of cycles from an instruction being issued to it being !argsTainted
-    // used to evaluate 
+    // the number of cycles from an instruction being held back by taint
+    // to it being !argsTainted is recorded by record_taint_delay()
 
     // print all rob lists including STT informations
     void print_robs();
@@ -289,6 +325,18 @@ class ROB
     // which means that we should execute this squash
     DynInstPtr getResolvedPendingSquashInst(ThreadID tid);
 
+    /** [STT] Stalled instructions whose arguments became untainted since
+     *  the IQ last drained this list. */
+    std::vector<DynInstPtr> &getUntaintedStallInsts(ThreadID tid)
+    { return untaintedStallInsts[tid]; }
+
+    /** Loads whose fenceDelay input (argsTainted with STT, otherwise
+     *  PrevBrsResolved) changed since the LSQ last drained this list.
+     *  Not filled for the Futuristic fence without STT, whose input
+     *  (PrevInstsCompleted) the LSQ rechecks on every load instead. */
+    std::vector<DynInstPtr> &getVisibleStateLoads(ThreadID tid)
+    { return visibleStateLoads[tid]; }
+
   private:
     /** Reset the ROB state */
     void resetState();
@@ -317,11 +365,109 @@ class ROB
     /*** [Jiyong,STT] explicit flow and implicit flow logic ***/
     /*   they are private because they can only be called by compute_taint()  */
     // if this instr has explicit flow wrt its producers
-    void explicit_flow(ThreadID tid, InstIt instIt);
+    void explicit_flow(ThreadID tid, const DynInstPtr &inst);
     // if this instr has explicit flow w.r.t its preceding branches
-    void implicit_flow(ThreadID tid, InstIt instIt);
+    void implicit_flow(ThreadID tid, const DynInstPtr &inst);
     // if this instr has its address tainted(only for memory instructions)
-    void address_flow(ThreadID tid, InstIt instIt);
+    void address_flow(ThreadID tid, const DynInstPtr &inst);
+    // derive argsTainted/destTainted from the flows computed above
+    void propagate_taint(const DynInstPtr &inst);
+    // write argsTainted, reporting stalled instructions that untaint
+    void set_args_tainted(const DynInstPtr &inst, bool tainted);
+    // sample the delay of a taint-stalled instruction that untainted
+    void record_taint_delay(const DynInstPtr &inst);
+
+    /*** [STT] taint engines, one thread at a time ***/
+    // re-evaluate every instruction of the thread, oldest first
+    void compute_taint_full(ThreadID tid);
+    // re-evaluate only the instructions queued in taintWorklist
+    void compute_taint_incremental(ThreadID tid);
+    // propagate taint over the taintSlots bit vectors
+    void compute_taint_bitvec(ThreadID tid);
+    // allocate/free the taintSlots entry of an instruction
+    void insert_taint_slot(const DynInstPtr &inst);
+    void retire_taint_slot(const DynInstPtr &inst);
+    // recompute hasImplicitFlow for instructions in (from, to]
+    void update_implicit_flow(ThreadID tid, InstSeqNum from, InstSeqNum to);
+    // seqNum of the oldest control instruction with explicit flow
+    InstSeqNum implicit_watermark(ThreadID tid) const;
+    // run the full engine and panic if it disagrees with the current flags
+    void check_taint(ThreadID tid);
+    // queue an instruction for re-evaluation by the incremental engine
+    void mark_taint_dirty(const DynInstPtr &inst);
+    // pack the taint flags of an instruction, used for cross-checking
+    static unsigned taint_state(const DynInstPtr &inst);
+
+    /** [STT] Instructions whose taint inputs changed since the last
+     *  compute_taint(), keyed (and so processed) in program order. */
+    std::map<InstSeqNum, DynInstPtr> taintWorklist[Impl::MaxThreads];
+
+    /** [STT] Control instructions in the ROB with explicit flow.  Any
+     *  instruction younger than the first one has implicit flow. */
+    std::set<InstSeqNum> taintedCtrlInsts[Impl::MaxThreads];
+
+    /** Whether updateVisibleState() follows the branch-resolution
+     *  frontier instead of walking the ROB (Spectre threat model). */
+    bool trackBrFrontier;
+
+    /** [STT] Control instructions not known to be resolved, keyed by
+     *  seqNum.  The first one is the branch-resolution frontier: it and
+     *  every older instruction have PrevBrsResolved set.  Younger ones
+     *  are only checked once they become the frontier. */
+    std::map<InstSeqNum, DynInstPtr> unresolvedCtrlInsts[Impl::MaxThreads];
+
+    /** [STT] First instruction the frontier has not passed yet. */
+    InstIt brFrontierIt[Impl::MaxThreads];
+
+    // advance the branch-resolution frontier and mark what it passed
+    void update_br_frontier(ThreadID tid);
+    // mark an instruction whose older branches are all resolved
+    void set_prev_brs_resolved(ThreadID tid, const DynInstPtr &inst);
+
+    /** [STT] The implicit_watermark() the hasImplicitFlow flags of the
+     *  incremental engine currently reflect. */
+    InstSeqNum implicitWatermark[Impl::MaxThreads];
+
+    /** [STT] Per-thread taint state of the bit-vector engine.  Every ROB
+     *  entry owns a slot (its robIdx) in circular program order, and each
+     *  vector holds one bit per slot.
+     */
+    struct TaintSlots {
+        /** Instruction in each slot. */
+        std::vector<DynInstPtr> insts;
+        /** Slots reading each slot's result, and the subset reading it as
+         *  an address operand. */
+        std::vector<TaintVector> consumers;
+        std::vector<TaintVector> addrConsumers;
+        /** Occupied slots, tainted roots (squashable loads) and control
+         *  instructions. */
+        TaintVector valid;
+        TaintVector roots;
+        TaintVector ctrl;
+        /** Taint flags as last written to the instructions. */
+        TaintVector argsTainted;
+        TaintVector destTainted;
+        TaintVector addrTainted;
+        TaintVector implicitFlow;
+        /** Scratch vectors for compute_taint_bitvec(). */
+        TaintVector nextArgs;
+        TaintVector nextDest;
+        TaintVector nextAddr;
+        TaintVector nextImplicit;
+        TaintVector frontier;
+        TaintVector reach;
+        /** Oldest occupied slot and next free slot. */
+        unsigned head;
+        unsigned tail;
+    };
+
+    TaintSlots taintSlots[Impl::MaxThreads];
+
+    /** [STT] See getUntaintedStallInsts(). */
+    std::vector<DynInstPtr> untaintedStallInsts[Impl::MaxThreads];
+
+    /** See getVisibleStateLoads(). */
+    std::vector<DynInstPtr> visibleStateLoads[Impl::MaxThreads];
 
   public:
     /** Iterator pointing to the instruction which is the last instruction
@@ -365,6 +511,26 @@ class ROB
     Stats::Scalar robReads;
     // The number of rob_writes
     Stats::Scalar robWrites;
+    /** Instructions in the ROB, summed over the cycles. */
+    Stats::Scalar occupancy;
+    Stats::Formula avgOccupancy;
+
+    /** [STT] Instructions whose older branches all became resolved. */
+    Stats::Scalar visibilityPointAdvances;
+    /** [STT] Instructions the visibility point advances by per cycle. */
+    Stats::Formula visibilityPointAdvanceRate;
+
+    /** [STT] Cycles from being held back by taint to untaint, for loads
+     *  (fenceDelay), branches (pending squash) and the other
+     *  moreTransmitInsts classes (stall list). STT never holds back
+     *  stores in this model. */
+    Stats::Histogram loadTaintDelay;
+    Stats::Histogram branchTaintDelay;
+    Stats::Histogram otherTaintDelay;
+
+  public:
+    /** [STT] Per-PC taint delays, top-N dumped with the stats. */
+    TaintPCStats taintPCStats;
 };
 
 #endif //__CPU_O3_ROB_HH__
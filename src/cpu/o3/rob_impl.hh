@@ -44,8 +44,12 @@
 #ifndef __CPU_O3_ROB_IMPL_HH__
 #define __CPU_O3_ROB_IMPL_HH__
 
+#include <iterator>
+#include <limits>
 #include <list>
 
+#include "base/callback.hh"
+#include "base/logging.hh"
 #include "cpu/o3/rob.hh"
 #include "debug/Fetch.hh"
 #include "debug/ROB.hh"
@@ -59,7 +63,9 @@ ROB<Impl>::ROB(O3CPU *_cpu, DerivO3CPUParams *params)
       numEntries(params->numROBEntries),
       squashWidth(params->squashWidth),
       numInstsInROB(0),
-      numThreads(params->numThreads)
+      numThreads(params->numThreads),
+      taintPCStats(_cpu->name() + ".rob.taintPCs",
+                   params->STT ? params->sttPCStatsTopN : 0)
 {
     std::string policy = params->smtROBPolicy;
 
@@ -103,6 +109,51 @@ ROB<Impl>::ROB(O3CPU *_cpu, DerivO3CPUParams *params)
                     "Partitioned, Threshold}");
     }
 
+    std::string engine = params->taintEngine;
+
+    //Convert string to lowercase
+    std::transform(engine.begin(), engine.end(), engine.begin(),
+                   (int(*)(int)) tolower);
+
+    //Figure out taint engine
+    if (engine == "full") {
+        taintEngine = FullTaint;
+    } else if (engine == "incremental") {
+        taintEngine = IncrementalTaint;
+    } else if (engine == "bitvector") {
+        taintEngine = BitVectorTaint;
+    } else {
+        assert(0 && "Invalid Taint Engine.Options Are:{Full, Incremental, "
+                    "BitVector}");
+    }
+
+    // Only compute_taint() drives the engines, and it needs STT
+    if (!params->STT)
+        taintEngine = FullTaint;
+
+    if (taintEngine == BitVectorTaint) {
+        for (ThreadID tid = 0; tid < numThreads; tid++) {
+            TaintSlots &slots = taintSlots[tid];
+            slots.insts.resize(numEntries);
+            slots.consumers.assign(numEntries, TaintVector(numEntries));
+            slots.addrConsumers.assign(numEntries, TaintVector(numEntries));
+            for (TaintVector *vec : { &slots.valid, &slots.roots, &slots.ctrl,
+                    &slots.argsTainted, &slots.destTainted,
+                    &slots.addrTainted, &slots.implicitFlow,
+                    &slots.nextArgs, &slots.nextDest, &slots.nextAddr,
+                    &slots.nextImplicit, &slots.frontier, &slots.reach }) {
+                vec->resize(numEntries);
+            }
+        }
+    }
+
+    checkTaint = params->checkTaint;
+
+    // Under the Spectre threat model an instruction is unsquashable once
+    // its older branches resolve, which the frontier tracks directly
+    std::string threat_model = params->threatModel;
+    trackBrFrontier = threat_model == "Spectre";
+
     resetState();
 }
 
@@ -115,6 +166,24 @@ ROB<Impl>::resetState()
         threadEntries[tid] = 0;
         squashIt[tid] = instList[tid].end();
         squashedSeqNum[tid] = 0;
+        taintWorklist[tid].clear();
+        taintedCtrlInsts[tid].clear();
+        implicitWatermark[tid] = implicit_watermark(tid);
+        untaintedStallInsts[tid].clear();
+        visibleStateLoads[tid].clear();
+        unresolvedCtrlInsts[tid].clear();
+        brFrontierIt[tid] = instList[tid].end();
+
+        TaintSlots &slots = taintSlots[tid];
+        for (auto &inst : slots.insts)
+            inst = NULL;
+        for (TaintVector *vec : { &slots.valid, &slots.roots, &slots.ctrl,
+                &slots.argsTainted, &slots.destTainted, &slots.addrTainted,
+                &slots.implicitFlow }) {
+            vec->clear();
+        }
+        slots.head = 0;
+        slots.tail = 0;
     }
     numInstsInROB = 0;
 
@@ -221,23 +290,41 @@ ROB<Impl>::insertInst(DynInstPtr &inst)
 
     ThreadID tid = inst->threadNumber;
 
-    /*** [Jiyong,STT] add logic for setting argProducers ***/
-    for (auto prevInstIt = instList[tid].begin(); prevInstIt != instList[tid].end(); prevInstIt++){
-        // find matched physical reg between prev instr and inst
-        DynInstPtr prevInst = (*prevInstIt);
+    /*** [STT] argProducers are linked at rename, record the reverse links;
+     *   Akk[DOPP2] selective replay follows them too ***/
+    if (taintEngine == IncrementalTaint || cpu->doppSelectiveReplay) {
         for (int i = 0; i < inst->numSrcRegs(); i++) {
-            if (inst->srcRegIdx(i).index() == 16)   // exclude zero register (zero register cannot be tainted)
-                continue;
-            for (int j = 0; j < prevInst->numDestRegs(); j++){
-                if (inst->renamedSrcRegIdx(i) == prevInst->renamedDestRegIdx(j)){
-                    inst->setArgProducer(i, prevInst);
-                }
-            }
+            DynInstPtr producer = inst->getArgProducer(i);
+            if (producer && !producer->isCommitted())
+                producer->addArgConsumer(inst);
+        }
+    }
+
+    /*** Akk[DOPP] predict the doppelganger address as the load is
+     *   dispatched; its doppelganger can issue from the next cycle on ***/
+    if (cpu->doppAddrPred && inst->isLoad()) {
+        Addr pred_addr;
+        if (cpu->doppAddrPred->predict(tid, inst->instAddr(), inst->seqNum,
+                                       pred_addr)) {
+            inst->doppPredAddr = pred_addr;
+            inst->hasDOPPAddrPred(true);
         }
     }
 
+    // the frontier has passed everything, so it stops at inst next
+    bool at_frontier = brFrontierIt[tid] == instList[tid].end();
+
     instList[tid].push_back(inst);
 
+    if (at_frontier)
+        brFrontierIt[tid] = std::prev(instList[tid].end());
+    if (trackBrFrontier && inst->isControl())
+        unresolvedCtrlInsts[tid].emplace(inst->seqNum, inst);
+
+    mark_taint_dirty(inst);
+    if (taintEngine == BitVectorTaint)
+        insert_taint_slot(inst);
+
     //Set Up head iterator if this is the 1st instruction in the ROB
     if (numInstsInROB == 0) {
         head = instList[tid].begin();
@@ -282,22 +369,43 @@ ROB<Impl>::retireHead(ThreadID tid)
     --numInstsInROB;
     --threadEntries[tid];
 
+    /*** Akk[DOPP] train on committed loads in program order; squashed
+     *   ones were released in doSquash() ***/
+    if (cpu->doppAddrPred && head_inst->isLoad() &&
+        !head_inst->isSquashed() && head_inst->effAddrValid()) {
+        cpu->doppAddrPred->train(tid, head_inst->instAddr(),
+                                 head_inst->seqNum, head_inst->effAddr,
+                                 head_inst->hasDOPPAddrPred());
+    }
+
     head_inst->clearInROB();
     head_inst->setCommitted();
 
+    if (brFrontierIt[tid] == head_it)
+        ++brFrontierIt[tid];
+    if (head_inst->isControl())
+        unresolvedCtrlInsts[tid].erase(head_inst->seqNum);
+
     instList[tid].erase(head_it);
 
-    /*** [Jiyong,STT] add logic for clearing argProducers ***/
-    for (auto nextInstIt = std::next(instList[tid].begin()); nextInstIt != instList[tid].end(); nextInstIt++){
-        // find matched physical reg between head_inst and next instr
-        DynInstPtr nextInst = (*nextInstIt);
-        for (int i = 0; i < nextInst->numSrcRegs(); i++){
-            if (nextInst->getArgProducer(i) == head_inst)
-                nextInst->clearArgProducer(i);
+    /*** [STT] a committed producer no longer taints its consumers ***/
+    if (taintEngine == IncrementalTaint) {
+        taintWorklist[tid].erase(head_inst->seqNum);
+        if (head_inst->isDestTainted()) {
+            for (auto &consumer : head_inst->getArgConsumers())
+                mark_taint_dirty(consumer);
         }
+    } else if (taintEngine == BitVectorTaint) {
+        retire_taint_slot(head_inst);
     }
+    head_inst->clearArgConsumers();
 
-    // clear argProducer for head_inst
+    if (head_inst->isControl())
+        taintedCtrlInsts[tid].erase(head_inst->seqNum);
+
+    /*** [STT] consumers keep their link to head_inst; setCommitted() above
+     *   is what invalidates it for explicit_flow()/address_flow().
+     *   Only drop head_inst's own links so retired chains are freed. ***/
     for (int i = 0; i < head_inst->numSrcRegs(); i++)
         head_inst->clearArgProducer(i);
 
@@ -323,6 +431,19 @@ ROB<Impl>::isHeadReady(ThreadID tid)
     return false;
 }
 
+template <class Impl>
+bool
+ROB<Impl>::isQuiescent(ThreadID tid) const
+{
+    if (threadEntries[tid] != 0 &&
+        instList[tid].front()->readyToCommit() &&
+        instList[tid].front()->isLoadSafeToCommit()) {
+        return false;
+    }
+
+    return visibleStateLoads[tid].empty() && untaintedStallInsts[tid].empty();
+}
+
 template <class Impl>
 bool
 ROB<Impl>::canCommit()
@@ -389,6 +510,16 @@ ROB<Impl>::doSquash(ThreadID tid)
                 (*squashIt[tid])->pcState(),
                 (*squashIt[tid])->seqNum);
 
+        /*** Akk[DOPP] repair the predictor youngest first, before the
+         *   correct path is dispatched. An older squash walks over this
+         *   load again, so its prediction is released only once ***/
+        if (cpu->doppAddrPred && (*squashIt[tid])->isLoad()) {
+            cpu->doppAddrPred->squash(tid, (*squashIt[tid])->instAddr(),
+                                      (*squashIt[tid])->seqNum,
+                                      (*squashIt[tid])->hasDOPPAddrPred());
+            (*squashIt[tid])->hasDOPPAddrPred(false);
+        }
+
         // Mark the instruction as squashed, and ready to commit so that
         // it can drain out of the pipeline.
         (*squashIt[tid])->setSquashed();
@@ -397,7 +528,6 @@ ROB<Impl>::doSquash(ThreadID tid)
 
         (*squashIt[tid])->setCanCommit();
 
-
         if (squashIt[tid] == instList[tid].begin()) {
             DPRINTF(ROB, "Reached head of instruction list while "
                     "squashing.\n");
@@ -452,6 +582,11 @@ ROB<Impl>::updateVisibleState()
         if (instList[tid].empty())
             continue;
 
+        if (trackBrFrontier) {
+            update_br_frontier(tid);
+            continue;
+        }
+
         InstIt inst_it = instList[tid].begin();
         InstIt tail_inst_it = instList[tid].end();
 
@@ -474,8 +609,9 @@ ROB<Impl>::updateVisibleState()
                 if (prevInstsComplete) {
                     inst->setPrevInstsCompleted();
                 }
-                if (prevBrsResolved){
+                if (prevBrsResolved && !inst->isPrevBrsResolved()) {
                     inst->setPrevBrsResolved();
+                    ++visibilityPointAdvances;
                 }
                 if (prevInstsCommitted) {
                     inst->setPrevInstsCommitted();
@@ -511,6 +647,7 @@ ROB<Impl>::updateVisibleState()
             }
 
             /*** [Jiyong, STT] add logic for updating flags when apply STT ***/
+            bool wasUnsquashable = inst->isUnsquashable();
             if (cpu->protectionEnabled && !cpu->isInvisibleSpec){
                 // fence
                 //if ((cpu->isFuturistic && inst->isPrevInstsCommitted()) ||
@@ -535,11 +672,71 @@ ROB<Impl>::updateVisibleState()
                 // unsafebaseline
                 inst->isUnsquashable(true);
             }
+
+            if (inst->isAccess() && inst->isUnsquashable() != wasUnsquashable) {
+                mark_taint_dirty(inst);
+                if (taintEngine == BitVectorTaint)
+                    taintSlots[tid].roots.set(inst->robIdx,
+                                              !inst->isUnsquashable());
+            }
         }
     }
 }
 
 
+/* **************************
+ * update isPrevBrsResolved from the branch-resolution frontier,
+ * in O(log n) per control instruction rather than O(ROB) per cycle.
+ * Other flags of updateVisibleState() are not used under Spectre.
+ * *************************/
+template <class Impl>
+void
+ROB<Impl>::update_br_frontier(ThreadID tid)
+{
+    std::map<InstSeqNum, DynInstPtr> &unresolved = unresolvedCtrlInsts[tid];
+
+    // drop the frontier while it is resolved; a younger branch that
+    // resolved first is dropped once it becomes the frontier
+    while (!unresolved.empty()) {
+        const DynInstPtr &inst = unresolved.begin()->second;
+        if (!inst->readyToCommit() || inst->getFault() != NoFault
+                || inst->isSquashed())
+            break;
+        unresolved.erase(unresolved.begin());
+    }
+
+    InstSeqNum frontier = unresolved.empty() ?
+        std::numeric_limits<InstSeqNum>::max() : unresolved.begin()->first;
+
+    // the frontier branch itself only depends on older branches
+    InstIt &it = brFrontierIt[tid];
+    while (it != instList[tid].end() && (*it)->seqNum <= frontier) {
+        set_prev_brs_resolved(tid, *it);
+        ++it;
+    }
+}
+
+template <class Impl>
+void
+ROB<Impl>::set_prev_brs_resolved(ThreadID tid, const DynInstPtr &inst)
+{
+    inst->setPrevBrsResolved();
+    ++visibilityPointAdvances;
+
+    // without STT the LSQ fences loads until this point
+    if (!cpu->STT && inst->isLoad())
+        visibleStateLoads[tid].push_back(inst);
+
+    if (!inst->isUnsquashable()) {
+        inst->isUnsquashable(true);
+        if (inst->isAccess()) {
+            mark_taint_dirty(inst);
+            if (taintEngine == BitVectorTaint)
+                taintSlots[tid].roots.reset(inst->robIdx);
+        }
+    }
+}
+
 template <class Impl>
 void
 ROB<Impl>::updateHead()
@@ -687,6 +884,49 @@ ROB<Impl>::regStats()
     robWrites
         .name(name() + ".rob_writes")
         .desc("The number of ROB writes");
+
+    occupancy
+        .name(name() + ".occupancy")
+        .desc("Instructions in the ROB, accumulated every cycle");
+
+    avgOccupancy
+        .name(name() + ".avgOccupancy")
+        .desc("Average number of instructions in the ROB");
+    avgOccupancy = occupancy / cpu->numCycles;
+
+    visibilityPointAdvances
+        .name(name() + ".visibilityPointAdvances")
+        .desc("Number of instructions whose older branches all resolved");
+
+    visibilityPointAdvanceRate
+        .name(name() + ".visibilityPointAdvanceRate")
+        .desc("Instructions the visibility point advances by per cycle");
+    visibilityPointAdvanceRate = visibilityPointAdvances / cpu->numCycles;
+
+    loadTaintDelay
+        .init(16)
+        .name(name() + ".loadTaintDelay")
+        .desc("Cycles loads were delayed by tainted arguments")
+        .flags(pdf);
+
+    branchTaintDelay
+        .init(16)
+        .name(name() + ".branchTaintDelay")
+        .desc("Cycles branch squashes were delayed by tainted arguments")
+        .flags(pdf);
+
+    otherTaintDelay
+        .init(16)
+        .name(name() + ".otherTaintDelay")
+        .desc("Cycles other transmitters were delayed by tainted arguments")
+        .flags(pdf);
+
+    if (cpu->STT) {
+        registerDumpCallback(new MakeCallback<TaintPCStats,
+                             &TaintPCStats::dump>(&taintPCStats));
+        registerResetCallback(new MakeCallback<TaintPCStats,
+                              &TaintPCStats::reset>(&taintPCStats));
+    }
 }
 
 template <class Impl>
@@ -706,9 +946,8 @@ ROB<Impl>::findInst(ThreadID tid, InstSeqNum squash_inst)
  */
 template <class Impl>
 void
-ROB<Impl>::explicit_flow(ThreadID tid, InstIt instIt)
+ROB<Impl>::explicit_flow(ThreadID tid, const DynInstPtr &inst)
 {
-    DynInstPtr inst = (*instIt);
     for (int i = 0; i < inst->numSrcRegs(); i++){
         if (inst->getArgProducer(i) != DynInstPtr()){
             DynInstPtr argProducer = inst->getArgProducer(i);
@@ -716,19 +955,22 @@ ROB<Impl>::explicit_flow(ThreadID tid, InstIt instIt)
             if (argProducer->isDestTainted()
                 && !argProducer->isCommitted()) {
                 inst->hasExplicitFlow(true);
+                if (cpu->impChannel && inst->isControl())
+                    taintedCtrlInsts[tid].insert(inst->seqNum);
                 return;
             }
         }
     }
     inst->hasExplicitFlow(false);
+    if (cpu->impChannel && inst->isControl())
+        taintedCtrlInsts[tid].erase(inst->seqNum);
     return;
 }
 
 template <class Impl>
 void
-ROB<Impl>::address_flow(ThreadID tid, InstIt instIt)
+ROB<Impl>::address_flow(ThreadID tid, const DynInstPtr &inst)
 {
-    DynInstPtr inst = (*instIt);
     if (inst->isMemRef()) {
         if (inst->isStore()) {
             for (int i = 1; i < inst->numSrcRegs(); i++){
@@ -770,22 +1012,309 @@ ROB<Impl>::address_flow(ThreadID tid, InstIt instIt)
 
 template <class Impl>
 void
-ROB<Impl>::implicit_flow(ThreadID tid, InstIt instIt)
+ROB<Impl>::implicit_flow(ThreadID tid, const DynInstPtr &inst)
 {
-    DynInstPtr inst = (*instIt);
+    // Every older control instruction has already been evaluated, so the
+    // watermark is final as far as this instruction is concerned.
     if (cpu->impChannel) {
-        for (auto prevInstIt = instList[tid].begin(); prevInstIt != instIt; prevInstIt++) {
-            DynInstPtr prevInst = (*prevInstIt);
-            if (prevInst->isControl() && prevInst->hasExplicitFlow()) {
-                inst->hasImplicitFlow(true);
-                return;
-            }
-        }
+        inst->hasImplicitFlow(implicit_watermark(tid) < inst->seqNum);
+        return;
     }
     inst->hasImplicitFlow(false);
     return;
 }
 
+template <class Impl>
+InstSeqNum
+ROB<Impl>::implicit_watermark(ThreadID tid) const
+{
+    if (taintedCtrlInsts[tid].empty())
+        return std::numeric_limits<InstSeqNum>::max();
+    return *taintedCtrlInsts[tid].begin();
+}
+
+template <class Impl>
+void
+ROB<Impl>::set_args_tainted(const DynInstPtr &inst, bool tainted)
+{
+    if (!tainted && inst->isArgsTainted()) {
+        // the IQ parks ready but tainted instructions until this flips
+        if (inst->isInStallList())
+            untaintedStallInsts[inst->threadNumber].push_back(inst);
+        if (inst->isTaintStalled())
+            record_taint_delay(inst);
+    }
+    // with STT the LSQ fences loads on their taint
+    if (tainted != inst->isArgsTainted() && inst->isLoad())
+        visibleStateLoads[inst->threadNumber].push_back(inst);
+    inst->isArgsTainted(tainted);
+}
+
+template <class Impl>
+void
+ROB<Impl>::record_taint_delay(const DynInstPtr &inst)
+{
+    Cycles delay = cpu->curCycle() - inst->taintStallCycle;
+    const char *inst_class;
+
+    if (inst->isLoad()) {
+        loadTaintDelay.sample(delay);
+        inst_class = "load";
+    } else if (inst->isControl()) {
+        branchTaintDelay.sample(delay);
+        inst_class = "branch";
+    } else {
+        otherTaintDelay.sample(delay);
+        inst_class = "other";
+    }
+    taintPCStats.record(inst->instAddr(), inst_class, delay);
+
+    // a later stall is timed from its own start
+    inst->clearTaintStall();
+}
+
+template <class Impl>
+void
+ROB<Impl>::propagate_taint(const DynInstPtr &inst)
+{
+    set_args_tainted(inst, inst->hasExplicitFlow());
+
+    inst->isDestTainted(inst->isArgsTainted());
+    if (inst->isAccess() && !inst->isUnsquashable()) {
+        inst->isDestTainted(true);
+    }
+}
+
+template <class Impl>
+void
+ROB<Impl>::compute_taint_full(ThreadID tid)
+{
+    for (auto &inst : instList[tid]) {
+        explicit_flow(tid, inst);
+        implicit_flow(tid, inst);
+        address_flow(tid, inst);
+        propagate_taint(inst);
+    }
+}
+
+template <class Impl>
+void
+ROB<Impl>::mark_taint_dirty(const DynInstPtr &inst)
+{
+    if (taintEngine != IncrementalTaint)
+        return;
+
+    taintWorklist[inst->threadNumber].emplace(inst->seqNum, inst);
+}
+
+template <class Impl>
+void
+ROB<Impl>::compute_taint_incremental(ThreadID tid)
+{
+    // Producers are always older than their consumers, so processing the
+    // worklist oldest first sees every producer's final taint for this
+    // cycle, exactly like the in-order walk of compute_taint_full().
+    while (!taintWorklist[tid].empty()) {
+        auto entry = taintWorklist[tid].begin();
+        DynInstPtr inst = entry->second;
+        taintWorklist[tid].erase(entry);
+
+        assert(inst->isInROB());
+
+        bool wasDestTainted = inst->isDestTainted();
+
+        explicit_flow(tid, inst);
+        implicit_flow(tid, inst);
+        address_flow(tid, inst);
+        propagate_taint(inst);
+
+        if (inst->isDestTainted() != wasDestTainted) {
+            for (auto &consumer : inst->getArgConsumers())
+                mark_taint_dirty(consumer);
+        }
+    }
+
+    // Only instructions between the old and the new watermark change
+    // their implicit flow.
+    InstSeqNum watermark = implicit_watermark(tid);
+    if (watermark != implicitWatermark[tid]) {
+        update_implicit_flow(tid, std::min(watermark, implicitWatermark[tid]),
+                             std::max(watermark, implicitWatermark[tid]));
+        implicitWatermark[tid] = watermark;
+    }
+}
+
+template <class Impl>
+void
+ROB<Impl>::update_implicit_flow(ThreadID tid, InstSeqNum from, InstSeqNum to)
+{
+    for (auto &inst : instList[tid]) {
+        if (inst->seqNum > to)
+            break;
+        if (inst->seqNum > from)
+            implicit_flow(tid, inst);
+    }
+}
+
+template <class Impl>
+void
+ROB<Impl>::insert_taint_slot(const DynInstPtr &inst)
+{
+    TaintSlots &slots = taintSlots[inst->threadNumber];
+    unsigned slot = slots.tail;
+
+    assert(!slots.valid.test(slot));
+    slots.tail = (slots.tail + 1) % numEntries;
+
+    inst->robIdx = slot;
+    slots.insts[slot] = inst;
+    slots.consumers[slot].clear();
+    slots.addrConsumers[slot].clear();
+    slots.valid.set(slot);
+    slots.roots.set(slot, inst->isAccess() && !inst->isUnsquashable());
+    slots.ctrl.set(slot, inst->isControl());
+
+    // Same operands as explicit_flow() and address_flow()
+    for (int i = 0; i < inst->numSrcRegs(); i++) {
+        DynInstPtr producer = inst->getArgProducer(i);
+        if (!producer || !producer->isInROB())
+            continue;
+
+        slots.consumers[producer->robIdx].set(slot);
+        if (inst->isMemRef() && (inst->isStore() ? i >= 1 : inst->isLoad()))
+            slots.addrConsumers[producer->robIdx].set(slot);
+    }
+}
+
+template <class Impl>
+void
+ROB<Impl>::retire_taint_slot(const DynInstPtr &inst)
+{
+    TaintSlots &slots = taintSlots[inst->threadNumber];
+    unsigned slot = inst->robIdx;
+
+    assert(slot == slots.head);
+    slots.head = (slots.head + 1) % numEntries;
+
+    // Every consumer is younger, so nothing reads this slot any more
+    slots.insts[slot] = NULL;
+    slots.consumers[slot].clear();
+    slots.addrConsumers[slot].clear();
+    for (TaintVector *vec : { &slots.valid, &slots.roots, &slots.ctrl,
+            &slots.argsTainted, &slots.destTainted, &slots.addrTainted,
+            &slots.implicitFlow }) {
+        vec->reset(slot);
+    }
+}
+
+template <class Impl>
+void
+ROB<Impl>::compute_taint_bitvec(ThreadID tid)
+{
+    TaintSlots &slots = taintSlots[tid];
+
+    // Flood from the roots: each step ORs the consumer rows of the
+    // newly dest-tainted slots.  Every slot enters the frontier at most
+    // once, so the cost is O(tainted * ROB/64) words.
+    slots.nextArgs.clear();
+    slots.nextAddr.clear();
+    slots.nextDest = slots.roots;
+    slots.frontier = slots.roots;
+    while (slots.frontier.any()) {
+        slots.reach.clear();
+        slots.frontier.forEach([&](size_t producer) {
+            slots.reach |= slots.consumers[producer];
+            slots.nextAddr |= slots.addrConsumers[producer];
+        });
+        slots.nextArgs |= slots.reach;
+        slots.frontier.assignAndNot(slots.reach, slots.nextDest);
+        slots.nextDest |= slots.frontier;
+    }
+
+    // Everything younger than the oldest tainted control instruction
+    slots.nextImplicit.clear();
+    if (cpu->impChannel) {
+        slots.reach = slots.ctrl;
+        slots.reach &= slots.nextArgs;
+        size_t oldest = slots.reach.findNext(slots.head);
+        if (oldest == numEntries)
+            oldest = slots.reach.findNext(0);
+        if (oldest != numEntries) {
+            if (oldest < slots.tail) {
+                slots.nextImplicit.setRange(oldest + 1, slots.tail);
+            } else {
+                slots.nextImplicit.setRange(oldest + 1, numEntries);
+                slots.nextImplicit.setRange(0, slots.tail);
+            }
+            slots.nextImplicit &= slots.valid;
+        }
+    }
+
+    // Write back only the flags that changed
+    slots.reach = slots.argsTainted;
+    slots.reach ^= slots.nextArgs;
+    slots.reach.forEach([&](size_t slot) {
+        slots.insts[slot]->hasExplicitFlow(slots.nextArgs.test(slot));
+        set_args_tainted(slots.insts[slot], slots.nextArgs.test(slot));
+    });
+    std::swap(slots.argsTainted, slots.nextArgs);
+
+    slots.reach = slots.destTainted;
+    slots.reach ^= slots.nextDest;
+    slots.reach.forEach([&](size_t slot) {
+        slots.insts[slot]->isDestTainted(slots.nextDest.test(slot));
+    });
+    std::swap(slots.destTainted, slots.nextDest);
+
+    slots.reach = slots.addrTainted;
+    slots.reach ^= slots.nextAddr;
+    slots.reach.forEach([&](size_t slot) {
+        slots.insts[slot]->isAddrTainted(slots.nextAddr.test(slot));
+    });
+    std::swap(slots.addrTainted, slots.nextAddr);
+
+    slots.reach = slots.implicitFlow;
+    slots.reach ^= slots.nextImplicit;
+    slots.reach.forEach([&](size_t slot) {
+        slots.insts[slot]->hasImplicitFlow(slots.nextImplicit.test(slot));
+    });
+    std::swap(slots.implicitFlow, slots.nextImplicit);
+}
+
+template <class Impl>
+unsigned
+ROB<Impl>::taint_state(const DynInstPtr &inst)
+{
+    return (inst->hasExplicitFlow() << 0) |
+           (inst->hasImplicitFlow() << 1) |
+           (inst->isAddrTainted()   << 2) |
+           (inst->isArgsTainted()   << 3) |
+           (inst->isDestTainted()   << 4);
+}
+
+template <class Impl>
+void
+ROB<Impl>::check_taint(ThreadID tid)
+{
+    std::vector<unsigned> state;
+    state.reserve(instList[tid].size());
+    for (auto &inst : instList[tid])
+        state.push_back(taint_state(inst));
+
+    compute_taint_full(tid);
+
+    auto stateIt = state.begin();
+    for (auto &inst : instList[tid]) {
+        if (taint_state(inst) != *stateIt) {
+            print_robs();
+            panic("[tid:%i] [sn:%lli] taint engine mismatch: "
+                  "got %#x, full walk gives %#x\n",
+                  tid, inst->seqNum, *stateIt, taint_state(inst));
+        }
+        ++stateIt;
+    }
+}
+
 template <class Impl>
 void
 ROB<Impl>::compute_taint()
@@ -800,18 +1329,16 @@ ROB<Impl>::compute_taint()
         if (instList[tid].empty())
             continue;
 
-        for (auto instIt = instList[tid].begin(); instIt != instList[tid].end(); instIt++) {
-            explicit_flow(tid, instIt);
-            implicit_flow(tid, instIt);
-            address_flow(tid, instIt);
-            DynInstPtr inst = (*instIt);
-
-            inst->isArgsTainted(inst->hasExplicitFlow());
-
-            inst->isDestTainted(inst->isArgsTainted());
-            if (inst->isAccess() && !inst->isUnsquashable()) {
-                inst->isDestTainted(true);
-            }
+        if (taintEngine == IncrementalTaint) {
+            compute_taint_incremental(tid);
+            if (checkTaint)
+                check_taint(tid);
+        } else if (taintEngine == BitVectorTaint) {
+            compute_taint_bitvec(tid);
+            if (checkTaint)
+                check_taint(tid);
+        } else {
+            compute_taint_full(tid);
         }
     }
 }
@@ -866,7 +1393,10 @@ ROB<Impl>::print_robs()
             else
                 printf("Not Issued, ");
             printf("unsquashable=%d, DestTainted=%d, ArgsTainted=%d, ", inst->isUnsquashable(), inst->isDestTainted(), inst->isArgsTainted());
-            printf("PBR=%d, PBC=%d, PIR=%d, PIC=%d, ", inst->isPrevBrsResolved(), inst->isPrevBrsCommitted(), inst->isPrevInstsCompleted(), inst->isPrevInstsCommitted());
+            printf("PBR=%d, ", inst->isPrevBrsResolved());
+            // only the full walk of updateVisibleState() keeps these
+            if (!trackBrFrontier)
+                printf("PBC=%d, PIR=%d, PIC=%d, ", inst->isPrevBrsCommitted(), inst->isPrevInstsCompleted(), inst->isPrevInstsCommitted());
             for(int j = 0; j < inst->numSrcRegs(); j++){
                 printf("Producer[%d] = %p ", j, inst->getArgProducer(j).get());
                 if (inst->getArgProducer(j) != DynInstPtr())
@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_TAINT_PC_STATS_HH__
+#define __CPU_O3_TAINT_PC_STATS_HH__
+
+#include <ostream>
+#include <string>
+
+#include "base/types.hh"
+#include "cpu/o3/pc_stats_table.hh"
+
+/**
+ * [STT] per static PC breakdown of the cycles instructions were held back
+ * by tainted arguments (fenceDelay loads, stall-listed instructions and
+ * pending squashes). Only the top-N PCs by total delay are dumped, see
+ * PCStatsTable.
+ */
+class TaintPCStats
+{
+  public:
+    /**
+     * @param name Name of the table and of its output file.
+     * @param top_n Number of PCs dumped, 0 disables the table.
+     */
+    TaintPCStats(const std::string &name, unsigned top_n)
+        : table(name, top_n)
+    {
+    }
+
+    /** Counts a delay of the instruction at pc that is now untainted. */
+    void record(Addr pc, const char *inst_class, Counter delay)
+    {
+        if (!table.enabled())
+            return;
+        Entry &entry = table[pc];
+        entry.instClass = inst_class;
+        entry.count++;
+        entry.totalCycles += delay;
+        if (delay > entry.maxCycles)
+            entry.maxCycles = delay;
+    }
+
+    /** Writes the top-N PCs, called back on a stats dump. */
+    void dump() { table.dump(); }
+
+    /** Clears the table, called back on a stats reset. */
+    void reset() { table.reset(); }
+
+  private:
+    struct Entry {
+        const char *instClass = "";
+        Counter count = 0;
+        Counter totalCycles = 0;
+        Counter maxCycles = 0;
+
+        Counter rank() const { return totalCycles; }
+        static void printHeader(std::ostream &os);
+        void print(std::ostream &os) const;
+    };
+
+    PCStatsTable<Entry> table;
+};
+
+#endif // __CPU_O3_TAINT_PC_STATS_HH__
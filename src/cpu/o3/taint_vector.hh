@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#ifndef __CPU_O3_TAINT_VECTOR_HH__
+#define __CPU_O3_TAINT_VECTOR_HH__
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+
+/**
+ * [STT] A run-time sized bit vector with one bit per ROB slot.  The ROB
+ * uses it to hold STT taint state and producer/consumer rows so that
+ * taint can be propagated a 64-bit word at a time.
+ */
+class TaintVector
+{
+  public:
+    TaintVector() : numBits(0) {}
+
+    explicit TaintVector(size_t num_bits) { resize(num_bits); }
+
+    /** Resizes the vector and clears every bit. */
+    void
+    resize(size_t num_bits)
+    {
+        numBits = num_bits;
+        words.assign((num_bits + 63) / 64, 0);
+    }
+
+    size_t size() const { return numBits; }
+
+    bool
+    test(size_t idx) const
+    {
+        assert(idx < numBits);
+        return (words[idx / 64] >> (idx % 64)) & 1;
+    }
+
+    void
+    set(size_t idx)
+    {
+        assert(idx < numBits);
+        words[idx / 64] |= (uint64_t)1 << (idx % 64);
+    }
+
+    void
+    set(size_t idx, bool val)
+    {
+        if (val)
+            set(idx);
+        else
+            reset(idx);
+    }
+
+    void
+    reset(size_t idx)
+    {
+        assert(idx < numBits);
+        words[idx / 64] &= ~((uint64_t)1 << (idx % 64));
+    }
+
+    /** Clears every bit. */
+    void
+    clear()
+    {
+        for (auto &word : words)
+            word = 0;
+    }
+
+    bool
+    any() const
+    {
+        for (auto word : words) {
+            if (word)
+                return true;
+        }
+        return false;
+    }
+
+    /** Sets every bit in [from, to). */
+    void
+    setRange(size_t from, size_t to)
+    {
+        assert(from <= to && to <= numBits);
+        while (from < to && from % 64) {
+            set(from++);
+        }
+        while (from + 64 <= to) {
+            words[from / 64] = ~(uint64_t)0;
+            from += 64;
+        }
+        while (from < to) {
+            set(from++);
+        }
+    }
+
+    TaintVector &
+    operator|=(const TaintVector &other)
+    {
+        assert(numBits == other.numBits);
+        for (size_t i = 0; i < words.size(); i++)
+            words[i] |= other.words[i];
+        return *this;
+    }
+
+    TaintVector &
+    operator&=(const TaintVector &other)
+    {
+        assert(numBits == other.numBits);
+        for (size_t i = 0; i < words.size(); i++)
+            words[i] &= other.words[i];
+        return *this;
+    }
+
+    TaintVector &
+    operator^=(const TaintVector &other)
+    {
+        assert(numBits == other.numBits);
+        for (size_t i = 0; i < words.size(); i++)
+            words[i] ^= other.words[i];
+        return *this;
+    }
+
+    /** Sets this vector to a & ~b. */
+    void
+    assignAndNot(const TaintVector &a, const TaintVector &b)
+    {
+        assert(numBits == a.numBits && numBits == b.numBits);
+        for (size_t i = 0; i < words.size(); i++)
+            words[i] = a.words[i] & ~b.words[i];
+    }
+
+    /** Returns the first set bit at or after idx, or size() if none. */
+    size_t
+    findNext(size_t idx) const
+    {
+        if (idx >= numBits)
+            return numBits;
+
+        size_t word_idx = idx / 64;
+        uint64_t word = words[word_idx] & (~(uint64_t)0 << (idx % 64));
+        while (!word) {
+            if (++word_idx == words.size())
+                return numBits;
+            word = words[word_idx];
+        }
+        return word_idx * 64 + findLsbSet(word);
+    }
+
+    /** Calls func(idx) for every set bit, in index order. */
+    template <class Func>
+    void
+    forEach(Func func) const
+    {
+        for (size_t i = 0; i < words.size(); i++) {
+            uint64_t word = words[i];
+            while (word) {
+                int bit = findLsbSet(word);
+                func(i * 64 + bit);
+                word &= word - 1;
+            }
+        }
+    }
+
+  private:
+    /** The bits, 64 per word. */
+    std::vector<uint64_t> words;
+
+    /** Number of valid bits. */
+    size_t numBits;
+};
+
+#endif // __CPU_O3_TAINT_VECTOR_HH__
@@ -0,0 +1,48 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+from m5.params import *
+from m5.proxy import *
+from MemObject import MemObject
+
+# Connects a master and a slave simulated on different event queues. The
+# slave side is on the bridge's own eventq_index, the master side on
+# master_eventq_index.
+class EventQueueBridge(MemObject):
+    type = 'EventQueueBridge'
+    cxx_header = "mem/eventq_bridge.hh"
+    slave = SlavePort('Slave port, on the event queue of the bridge')
+    master = MasterPort('Master port, on master_eventq_index')
+    delay = Param.Latency('10ns', "Latency of a timing packet through "
+                          "the bridge")
+    master_eventq_index = Param.UInt32(Parent.eventq_index,
+                                       "Event queue of the master side")
+    deterministic = Param.Bool(False, "Hand packets over at quantum "
+                               "boundaries so that timing traffic does not "
+                               "depend on the host thread interleaving, "
+                               "needs a delay of at least the quantum")
@@ -587,6 +587,16 @@ class BaseCache : public MemObject
 
     virtual bool inMissQueue(Addr addr, bool is_secure) const = 0;
 
+    /**
+     * Copy data out of a readable block without accessing it, for
+     * prefetchers that follow pointers or indices. The bytes must not
+     * cross a block boundary.
+     *
+     * @return false if the block is not in the cache
+     */
+    virtual bool peekData(Addr addr, bool is_secure, unsigned size,
+                          uint8_t *data) const = 0;
+
     void incMissCount(PacketPtr pkt)
     {
         assert(pkt->req->masterId() < system->maxMasters());
@@ -49,11 +49,14 @@
 #define __MEM_CACHE_BLK_HH__
 
 #include <list>
+#include <memory>
 
 #include "base/printable.hh"
 #include "mem/packet.hh"
 #include "mem/request.hh"
 
+struct ReplacementData;
+
 /**
  * Cache block status bit assignments
  */
@@ -119,6 +122,9 @@ class CacheBlk
 
     Tick tickInserted;
 
+    /** What the replacement policy of the tags keeps about the block. */
+    std::shared_ptr<ReplacementData> replacementData;
+
   protected:
     /**
      * Represents that the indicated thread context has a "lock" on
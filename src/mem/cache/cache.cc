@@ -148,7 +148,7 @@ Cache::cmpAndSwap(CacheBlk *blk, PacketPtr pkt)
 
 
 void
-Cache::satisfyRequest(PacketPtr pkt, CacheBlk *blk,
+Cache::satisfyRequest(PacketPtr pkt, CacheBlk *blk, PacketList &writebacks,
                       bool deferred_response, bool pending_downgrade)
 {
     assert(pkt->isRequest());
@@ -167,6 +167,7 @@ Cache::satisfyRequest(PacketPtr pkt, CacheBlk *blk,
     // isWrite() will be true for them
     if (pkt->cmd == MemCmd::SwapReq) {
         cmpAndSwap(blk, pkt);
+        updateBlockData(blk, writebacks);
     } else if (pkt->isWrite()) {
         // we have the block in a writable state and can go ahead,
         // note that the line may be also be considered writable in
@@ -176,6 +177,7 @@ Cache::satisfyRequest(PacketPtr pkt, CacheBlk *blk,
         // Write or WriteLine at the first cache with block in writable state
         if (blk->checkWrite(pkt)) {
             pkt->writeDataToBlock(blk->data, blkSize);
+            updateBlockData(blk, writebacks);
         }
         // Always mark the line as dirty (and thus transition to the
         // Modified state) even if we are a failed StoreCond so we
@@ -318,7 +320,7 @@ Cache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
 
     // Here lat is the value passed as parameter to accessBlock() function
     // that can modify its value.
-    blk = tags->accessBlock(pkt->getAddr(), pkt->isSecure(), lat);
+    blk = tags->accessBlock(pkt, lat);
 
     DPRINTF(Cache, "%s %s\n", pkt->print(),
             blk ? "hit " + blk->print() : "miss");
@@ -417,6 +419,7 @@ Cache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
         // nothing else to do; writeback doesn't expect response
         assert(!pkt->needsResponse());
         std::memcpy(blk->data, pkt->getConstPtr<uint8_t>(), blkSize);
+        updateBlockData(blk, writebacks);
         DPRINTF(Cache, "%s new state is %s\n", __func__, blk->print());
         incHitCount(pkt);
         return true;
@@ -475,6 +478,7 @@ Cache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
         // nothing else to do; writeback doesn't expect response
         assert(!pkt->needsResponse());
         std::memcpy(blk->data, pkt->getConstPtr<uint8_t>(), blkSize);
+        updateBlockData(blk, writebacks);
         DPRINTF(Cache, "%s new state is %s\n", __func__, blk->print());
 
         incHitCount(pkt);
@@ -488,7 +492,7 @@ Cache::access(PacketPtr pkt, CacheBlk *&blk, Cycles &lat,
                        blk->isReadable())) {
         // OK to satisfy access
         incHitCount(pkt);
-        satisfyRequest(pkt, blk);
+        satisfyRequest(pkt, blk, writebacks);
         maintainClusivity(pkt->fromCache(), blk);
 
         return true;
@@ -775,8 +779,11 @@ Cache::recvTimingReq(PacketPtr pkt)
 
         if (prefetcher && (prefetchOnAccess ||
                            (blk && blk->wasPrefetched()))) {
-            if (blk)
+            if (blk) {
+                if (blk->wasPrefetched() && !pkt->cmd.isPrefetch())
+                    prefetcher->prefetchUseful(false);
                 blk->status &= ~BlkHWPrefetched;
+            }
 
             // Don't notify on SWPrefetch
             if (!pkt->cmd.isSWPrefetch()) {
@@ -886,6 +893,14 @@ Cache::recvTimingReq(PacketPtr pkt)
 
                     assert(pkt->req->masterId() < system->maxMasters());
                     mshr_hits[pkt->cmdToIndex()][pkt->req->masterId()]++;
+                    // the first demand to catch up with a prefetch in
+                    // flight makes it a late one
+                    if (prefetcher && !pkt->cmd.isPrefetch() &&
+                        mshr->getNumTargets() == 1 &&
+                        mshr->getTarget()->source ==
+                        MSHR::Target::FromPrefetcher) {
+                        prefetcher->prefetchUseful(true);
+                    }
                     // We use forward_time here because it is the same
                     // considering new targets. We have multiple
                     // requests for the same address here. It
@@ -925,6 +940,8 @@ Cache::recvTimingReq(PacketPtr pkt)
                 mshr_uncacheable[pkt->cmdToIndex()][pkt->req->masterId()]++;
             } else {
                 mshr_misses[pkt->cmdToIndex()][pkt->req->masterId()]++;
+                if (prefetcher && pkt->isRead() && !pkt->cmd.isPrefetch())
+                    prefetcher->demandMiss();
             }
 
             if (pkt->isEviction() || pkt->cmd == MemCmd::WriteClean ||
@@ -1169,14 +1186,14 @@ Cache::recvAtomic(PacketPtr pkt)
                                      allocOnFill(pkt->cmd));
                     assert(blk != NULL);
                     is_invalidate = false;
-                    satisfyRequest(pkt, blk);
+                    satisfyRequest(pkt, blk, writebacks);
                 } else if (bus_pkt->isRead() ||
                            bus_pkt->cmd == MemCmd::UpgradeResp) {
                     // we're updating cache state to allow us to
                     // satisfy the upstream request from the cache
                     blk = handleFill(bus_pkt, blk, writebacks,
                                      allocOnFill(pkt->cmd));
-                    satisfyRequest(pkt, blk);
+                    satisfyRequest(pkt, blk, writebacks);
                     maintainClusivity(pkt->fromCache(), blk);
                 } else {
                     // we're satisfying the upstream request without
@@ -1469,7 +1486,8 @@ Cache::recvTimingResp(PacketPtr pkt)
             }
 
             if (is_fill) {
-                satisfyRequest(tgt_pkt, blk, true, mshr->hasPostDowngrade());
+                satisfyRequest(tgt_pkt, blk, writebacks, true,
+                               mshr->hasPostDowngrade());
 
                 // How many bytes past the first request is this one
                 int transfer_offset =
@@ -1840,23 +1858,53 @@ Cache::allocateBlock(Addr addr, bool is_secure, PacketList &writebacks)
                     addr, is_secure ? "s" : "ns",
                     blk->isDirty() ? "writeback" : "clean");
 
-            if (blk->wasPrefetched()) {
-                unusedPrefetches++;
-            }
-            // Will send up Writeback/CleanEvict snoops via isCachedAbove
-            // when pushing this writeback list into the write buffer.
-            if (blk->isDirty() || writebackClean) {
-                // Save writeback packet for handling by caller
-                writebacks.push_back(writebackBlk(blk));
-            } else {
-                writebacks.push_back(cleanEvictBlk(blk));
-            }
+            evictBlock(blk, writebacks);
         }
     }
 
     return blk;
 }
 
+void
+Cache::evictBlock(CacheBlk *blk, PacketList &writebacks)
+{
+    if (blk->wasPrefetched()) {
+        unusedPrefetches++;
+    }
+    // Will send up Writeback/CleanEvict snoops via isCachedAbove
+    // when pushing this writeback list into the write buffer.
+    if (blk->isDirty() || writebackClean) {
+        // Save writeback packet for handling by caller
+        writebacks.push_back(writebackBlk(blk));
+    } else {
+        writebacks.push_back(cleanEvictBlk(blk));
+    }
+}
+
+void
+Cache::updateBlockData(CacheBlk *blk, PacketList &writebacks)
+{
+    if (blk == tempBlock)
+        return;
+
+    tags->updateBlockData(blk);
+
+    // too hard to replace blocks with transient state, the set stays
+    // over its capacity until it makes room again if only those remain
+    auto evictable = [this](CacheBlk *victim) {
+        Addr repl_addr = tags->regenerateBlkAddr(victim->tag, victim->set);
+        return !mshrQueue.findMatch(repl_addr, victim->isSecure());
+    };
+
+    while (CacheBlk *victim = tags->findOverflowVictim(blk, evictable)) {
+        DPRINTF(Cache, "replacement: evicting %#llx (%s) to fit %s\n",
+                tags->regenerateBlkAddr(victim->tag, victim->set),
+                victim->isSecure() ? "s" : "ns", blk->print());
+        evictBlock(victim, writebacks);
+        invalidateBlock(victim);
+    }
+}
+
 void
 Cache::invalidateBlock(CacheBlk *blk)
 {
@@ -1971,6 +2019,7 @@ Cache::handleFill(PacketPtr pkt, CacheBlk *blk, PacketList &writebacks,
         assert(pkt->getSize() == blkSize);
 
         std::memcpy(blk->data, pkt->getConstPtr<uint8_t>(), blkSize);
+        updateBlockData(blk, writebacks);
     }
     // We pay for fillLatency here.
     blk->whenReady = clockEdge() + fillLatency * clockPeriod() +
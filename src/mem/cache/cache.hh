@@ -52,6 +52,7 @@
 #ifndef __MEM_CACHE_CACHE_HH__
 #define __MEM_CACHE_CACHE_HH__
 
+#include <cstring>
 #include <unordered_set>
 
 #include "base/logging.hh" // fatal, panic, and warn
@@ -293,6 +294,18 @@ class Cache : public BaseCache
      */
     CacheBlk *allocateBlock(Addr addr, bool is_secure, PacketList &writebacks);
 
+    /**
+     * Write back a valid block that is being replaced, or tell the
+     * caches below that it is dropped if it is clean.
+     */
+    void evictBlock(CacheBlk *blk, PacketList &writebacks);
+
+    /**
+     * Tell the tags that the data of a block changed, and evict the
+     * blocks they pick if the set no longer fits.
+     */
+    void updateBlockData(CacheBlk *blk, PacketList &writebacks);
+
     /**
      * Invalidate a cache block.
      *
@@ -417,6 +430,8 @@ class Cache : public BaseCache
      *
      * @param pkt Request packet from upstream that hit a block
      * @param blk Cache block that the packet hit
+     * @param writebacks List for the blocks a write evicts to make
+     *                   room when the block grows
      * @param deferred_response Whether this hit is to block that
      *                          originally missed
      * @param pending_downgrade Whether the writable flag is to be removed
@@ -424,6 +439,7 @@ class Cache : public BaseCache
      * @return True if the block is to be invalidated
      */
     void satisfyRequest(PacketPtr pkt, CacheBlk *blk,
+                        PacketList &writebacks,
                         bool deferred_response = false,
                         bool pending_downgrade = false);
 
@@ -536,6 +552,17 @@ class Cache : public BaseCache
         return (mshrQueue.findMatch(addr, is_secure) != 0);
     }
 
+    bool peekData(Addr addr, bool is_secure, unsigned size,
+                  uint8_t *data) const override {
+        const CacheBlk *blk = tags->findBlock(addr, is_secure);
+        if (!blk || !blk->isReadable())
+            return false;
+        Addr offset = addr & Addr(blkSize - 1);
+        assert(offset + size <= blkSize);
+        std::memcpy(data, blk->data + offset, size);
+        return true;
+    }
+
     /**
      * Find next request ready time from among possible sources.
      */
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions shared by the cache block compression models.
+ */
+
+#include "mem/cache/compressors/base.hh"
+
+#include <cstring>
+
+#include "base/logging.hh"
+
+BaseCacheCompressor::BaseCacheCompressor(const Params *p)
+    : SimObject(p), decompressionLatency(p->decompression_latency)
+{
+}
+
+int64_t
+BaseCacheCompressor::readSigned(const uint8_t *data, unsigned size)
+{
+    switch (size) {
+      case 1: { int8_t v; std::memcpy(&v, data, 1); return v; }
+      case 2: { int16_t v; std::memcpy(&v, data, 2); return v; }
+      case 4: { int32_t v; std::memcpy(&v, data, 4); return v; }
+      case 8: { int64_t v; std::memcpy(&v, data, 8); return v; }
+      default:
+        panic("cannot read a %d byte integer", size);
+    }
+}
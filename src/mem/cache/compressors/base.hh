@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the interface of the cache block compression models.
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_BASE_HH__
+#define __MEM_CACHE_COMPRESSORS_BASE_HH__
+
+#include <cstdint>
+
+#include "base/types.hh"
+#include "params/BaseCacheCompressor.hh"
+#include "sim/sim_object.hh"
+
+/**
+ * A compressor tells how small the data of a block would be once
+ * compressed. Only the size is modelled: the cache keeps the data
+ * uncompressed, so nothing has to be decompressed functionally.
+ */
+class BaseCacheCompressor : public SimObject
+{
+  protected:
+    /** Read the integer of the given size at data, in host byte order */
+    static int64_t readSigned(const uint8_t *data, unsigned size);
+
+  public:
+    typedef BaseCacheCompressorParams Params;
+
+    /** Latency added to a hit on a compressed block */
+    const Cycles decompressionLatency;
+
+    BaseCacheCompressor(const Params *p);
+
+    virtual ~BaseCacheCompressor() {}
+
+    /**
+     * The size of a block once compressed.
+     * @param data The block data.
+     * @param size The block size, a multiple of 8 bytes.
+     * @return The compressed size in bytes, at most size.
+     */
+    virtual unsigned compressedSize(const uint8_t *data,
+                                    unsigned size) const = 0;
+};
+
+#endif // __MEM_CACHE_COMPRESSORS_BASE_HH__
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of the Base-Delta-Immediate compression model.
+ */
+
+#include "mem/cache/compressors/bdi.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+/** Whether v fits a signed integer of the given number of bytes */
+bool
+fitsDelta(int64_t v, unsigned delta_size)
+{
+    const int64_t limit = int64_t(1) << (8 * delta_size - 1);
+    return v >= -limit && v < limit;
+}
+
+} // anonymous namespace
+
+BDI::BDI(const Params *p)
+    : BaseCacheCompressor(p)
+{
+}
+
+unsigned
+BDI::baseDeltaSize(const uint8_t *data, unsigned size,
+                   unsigned base_size, unsigned delta_size)
+{
+    const unsigned n = size / base_size;
+    bool have_base = false;
+    int64_t base = 0;
+
+    for (unsigned i = 0; i < n; ++i) {
+        const int64_t v = readSigned(data + i * base_size, base_size);
+        // the implicit zero base
+        if (fitsDelta(v, delta_size))
+            continue;
+
+        if (!have_base) {
+            base = v;
+            have_base = true;
+        }
+        // neither is close to zero, so values of opposite signs are too
+        // far apart, and the difference of the others cannot overflow
+        if ((v < 0) != (base < 0) || !fitsDelta(v - base, delta_size))
+            return size;
+    }
+
+    // the base, the deltas, and one bit per value to select the base
+    return base_size + n * delta_size + (n + 7) / 8;
+}
+
+unsigned
+BDI::compressedSize(const uint8_t *data, unsigned size) const
+{
+    if (std::all_of(data, data + size, [](uint8_t b) { return b == 0; }))
+        return 1;
+
+    bool repeated = true;
+    for (unsigned i = 8; i < size && repeated; i += 8)
+        repeated = std::memcmp(data, data + i, 8) == 0;
+    if (repeated)
+        return 8;
+
+    static const struct { unsigned base, delta; } encodings[] = {
+        { 8, 1 }, { 8, 2 }, { 8, 4 }, { 4, 1 }, { 4, 2 }, { 2, 1 }
+    };
+
+    unsigned best = size;
+    for (const auto &e : encodings)
+        best = std::min(best, baseDeltaSize(data, size, e.base, e.delta));
+    return best;
+}
+
+BDI*
+BDIParams::create()
+{
+    return new BDI(this);
+}
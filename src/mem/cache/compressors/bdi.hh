@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the Base-Delta-Immediate compression model (Pekhimenko
+ * et al., PACT 2012).
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_BDI_HH__
+#define __MEM_CACHE_COMPRESSORS_BDI_HH__
+
+#include "mem/cache/compressors/base.hh"
+#include "params/BDI.hh"
+
+/**
+ * Compresses a block as an array of equal sized values that are all
+ * close either to zero or to one base, the first value that is not
+ * close to zero. Each value is stored as a narrow delta, with a bit
+ * telling which base it is relative to. Every combination of value and
+ * delta size is tried along with the all-zero and repeated value
+ * encodings, and the smallest wins. Arrays of pointers, offsets and
+ * small integers compress well.
+ */
+class BDI : public BaseCacheCompressor
+{
+  protected:
+    /**
+     * The size of the block with one value and delta size.
+     * @return The compressed size, or size if a value does not fit.
+     */
+    static unsigned baseDeltaSize(const uint8_t *data, unsigned size,
+                                  unsigned base_size, unsigned delta_size);
+
+  public:
+    typedef BDIParams Params;
+
+    BDI(const Params *p);
+
+    unsigned compressedSize(const uint8_t *data,
+                            unsigned size) const override;
+};
+
+#endif // __MEM_CACHE_COMPRESSORS_BDI_HH__
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of the Frequent Pattern Compression model.
+ */
+
+#include "mem/cache/compressors/fpc.hh"
+
+#include <algorithm>
+#include <cstring>
+
+namespace {
+
+const unsigned prefixBits = 3;
+const unsigned maxZeroRun = 8;
+
+/** Whether v is the sign extension of its low bits */
+bool
+signExtends(int32_t v, unsigned bits)
+{
+    const int32_t limit = int32_t(1) << (bits - 1);
+    return v >= -limit && v < limit;
+}
+
+} // anonymous namespace
+
+FPC::FPC(const Params *p)
+    : BaseCacheCompressor(p)
+{
+}
+
+unsigned
+FPC::wordBits(uint32_t word)
+{
+    const int32_t v = word;
+    const int16_t high = word >> 16;
+    const int16_t low = word & 0xffff;
+    const uint8_t byte = word & 0xff;
+
+    if (signExtends(v, 4))
+        return 4;
+    if (signExtends(v, 8))
+        return 8;
+    if (signExtends(v, 16))
+        return 16;
+    if (low == 0)
+        return 16;
+    if (high >= -128 && high < 128 && low >= -128 && low < 128)
+        return 16;
+    if (word == byte * 0x01010101u)
+        return 8;
+    return 32;
+}
+
+unsigned
+FPC::compressedSize(const uint8_t *data, unsigned size) const
+{
+    const unsigned words = size / sizeof(uint32_t);
+    unsigned bits = 0;
+    unsigned zero_run = 0;
+
+    for (unsigned i = 0; i < words; ++i) {
+        uint32_t word;
+        std::memcpy(&word, data + i * sizeof(uint32_t), sizeof(word));
+
+        if (word == 0) {
+            // a run takes one prefix and its length, however long
+            if (zero_run == 0)
+                bits += prefixBits + 3;
+            if (++zero_run == maxZeroRun)
+                zero_run = 0;
+            continue;
+        }
+        zero_run = 0;
+        bits += prefixBits + wordBits(word);
+    }
+
+    return std::min(size, (bits + 7) / 8);
+}
+
+FPC*
+FPCParams::create()
+{
+    return new FPC(this);
+}
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the Frequent Pattern Compression model (Alameldeen and
+ * Wood, 2004).
+ */
+
+#ifndef __MEM_CACHE_COMPRESSORS_FPC_HH__
+#define __MEM_CACHE_COMPRESSORS_FPC_HH__
+
+#include "mem/cache/compressors/base.hh"
+#include "params/FPC.hh"
+
+/**
+ * Compresses a block word by word. Each 32-bit word gets a 3-bit prefix
+ * naming the first of these patterns it matches, followed by what the
+ * pattern needs of it:
+ *
+ * - a run of up to 8 zero words, 3 bits for the run length
+ * - a 4-bit, 8-bit or 16-bit sign-extended value
+ * - a halfword padded with a zero halfword, 16 bits
+ * - two halfwords that are each a sign-extended byte, 16 bits
+ * - a word of one repeated byte, 8 bits
+ * - anything else, stored whole in 32 bits
+ *
+ * It handles small integers of mixed sizes better than BDI, at the cost
+ * of a longer, serial decompression.
+ */
+class FPC : public BaseCacheCompressor
+{
+  protected:
+    /** The size in bits of the pattern of one non-zero word */
+    static unsigned wordBits(uint32_t word);
+
+  public:
+    typedef FPCParams Params;
+
+    FPC(const Params *p);
+
+    unsigned compressedSize(const uint8_t *data,
+                            unsigned size) const override;
+};
+
+#endif // __MEM_CACHE_COMPRESSORS_FPC_HH__
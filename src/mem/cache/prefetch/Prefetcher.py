@@ -55,6 +55,14 @@ class BasePrefetcher(ClockedObject):
     on_data  = Param.Bool(True, "Notify prefetcher on data accesses")
     on_inst  = Param.Bool(True, "Notify prefetcher on instruction accesses")
 
+    # [STT] with a policy other than all, loads whose speculative access
+    # the prefetcher left out train it when they commit
+    train_on = Param.String("all", "Accesses that train the prefetcher "
+        "(all, visible: only those that cannot be squashed and committed "
+        "loads, doppelganger: visible ones and doppelganger loads)")
+    commit_sources = VectorParam.SimObject([], "CPUs whose committed loads "
+        "train the prefetcher")
+
 class QueuedPrefetcher(BasePrefetcher):
     type = "QueuedPrefetcher"
     abstract = True
@@ -90,3 +98,24 @@ class TaggedPrefetcher(QueuedPrefetcher):
     cxx_header = "mem/cache/prefetch/tagged.hh"
 
     degree = Param.Int(2, "Number of prefetches to generate")
+
+class IndirectMemoryPrefetcher(QueuedPrefetcher):
+    type = 'IndirectMemoryPrefetcher'
+    cxx_class = 'IndirectMemoryPrefetcher'
+    cxx_header = "mem/cache/prefetch/indirect_memory.hh"
+
+    pt_table_entries = Param.Unsigned(16, "Number of index streams tracked")
+    ipd_table_entries = Param.Unsigned(4,
+        "Number of index streams searched for an indirect pattern at once")
+    ipd_miss_window = Param.Unsigned(8,
+        "Misses after an index read that may be its indirect access")
+    shift_values = VectorParam.Int([3, 2, 4, -3],
+        "log2 of the indirect element sizes tried, negative values divide "
+        "the index (bit vectors)")
+
+    distance = Param.Unsigned(16, "Index array elements to prefetch ahead")
+
+    stream_thresh = Param.Int(2, "Repeated strides before a stream is used")
+    max_conf = Param.Int(7, "Maximum confidence level")
+    thresh_conf = Param.Int(2, "Threshold confidence level")
+    start_conf = Param.Int(4, "Starting confidence for new patterns")
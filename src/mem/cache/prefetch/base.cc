@@ -51,6 +51,7 @@
 #include <list>
 
 #include "base/intmath.hh"
+#include "base/logging.hh"
 #include "mem/cache/base.hh"
 #include "sim/system.hh"
 
@@ -58,9 +59,37 @@ BasePrefetcher::BasePrefetcher(const BasePrefetcherParams *p)
     : ClockedObject(p), cache(nullptr), blkSize(0), lBlkSize(0),
       system(p->sys), onMiss(p->on_miss), onRead(p->on_read),
       onWrite(p->on_write), onData(p->on_data), onInst(p->on_inst),
+      commitSources(p->commit_sources.begin(), p->commit_sources.end()),
+      observingCommit(false),
       masterId(system->getMasterId(name())),
       pageBytes(system->getPageBytes())
 {
+    if (p->train_on == "all") {
+        trainingPolicy = TrainAll;
+    } else if (p->train_on == "visible") {
+        trainingPolicy = TrainVisible;
+    } else if (p->train_on == "doppelganger") {
+        trainingPolicy = TrainDoppelganger;
+    } else {
+        fatal("%s: invalid train_on %s, the options are all, visible and "
+              "doppelganger\n", name(), p->train_on);
+    }
+}
+
+void
+BasePrefetcher::regProbeListeners()
+{
+    ClockedObject::regProbeListeners();
+
+    // with TrainAll the loads trained when they accessed the cache
+    if (trainingPolicy == TrainAll)
+        return;
+
+    // CPUs without the probe point never notify
+    for (auto source : commitSources) {
+        commitListeners.emplace_back(
+            new CommitListener(*this, source->getProbeManager()));
+    }
 }
 
 void
@@ -82,10 +111,80 @@ BasePrefetcher::regStats()
         .desc("number of hwpf issued")
         ;
 
+    pfTrained
+        .init(NumAccessSources)
+        .name(name() + ".pfTrained")
+        .desc("number of accesses the prefetcher trained on, per source")
+        .flags(Stats::total | Stats::nozero);
+    pfTrainFiltered
+        .init(NumAccessSources)
+        .name(name() + ".pfTrainFiltered")
+        .desc("number of accesses left out of training by train_on")
+        .flags(Stats::total | Stats::nozero);
+    for (auto stat : { &pfTrained, &pfTrainFiltered }) {
+        stat->subname(VisibleAccess, "visible");
+        stat->subname(SquashableAccess, "squashable");
+        stat->subname(DoppelgangerAccess, "doppelganger");
+        stat->subname(CommittedLoad, "committed");
+    }
+
+    pfUseful
+        .name(name() + ".pfUseful")
+        .desc("number of demand accesses hitting a prefetched block");
+
+    pfLate
+        .name(name() + ".pfLate")
+        .desc("number of demand accesses waiting for a prefetch in flight");
+
+    pfDemandMisses
+        .name(name() + ".pfDemandMisses")
+        .desc("number of demand read misses not covered by a prefetch");
+
+    pfAccuracy
+        .name(name() + ".pfAccuracy")
+        .desc("fraction of the issued prefetches used by a demand access");
+    pfAccuracy = (pfUseful + pfLate) / pfIssued;
+
+    pfCoverage
+        .name(name() + ".pfCoverage")
+        .desc("fraction of the demand misses a prefetch was issued for");
+    pfCoverage = (pfUseful + pfLate) / (pfUseful + pfLate + pfDemandMisses);
+
+    pfLateness
+        .name(name() + ".pfLateness")
+        .desc("fraction of the used prefetches that arrived late");
+    pfLateness = pfLate / (pfUseful + pfLate);
+}
+
+BasePrefetcher::AccessSource
+BasePrefetcher::accessSource(const PacketPtr &pkt) const
+{
+    if (observingCommit)
+        return CommittedLoad;
+    if (pkt->req->isDoppelganger())
+        return DoppelgangerAccess;
+    if (pkt->req->isSquashable())
+        return SquashableAccess;
+    return VisibleAccess;
+}
+
+void
+BasePrefetcher::trainOnCommit(const PacketPtr &pkt)
+{
+    // a doppelganger trained already if the policy allows it
+    if (trainingPolicy == TrainDoppelganger && pkt->req->isDoppelganger())
+        return;
+
+    observingCommit = true;
+    Tick next_pf_time = notify(pkt);
+    observingCommit = false;
+
+    if (next_pf_time != MaxTick)
+        cache->schedMemSideSendEvent(next_pf_time);
 }
 
 bool
-BasePrefetcher::observeAccess(const PacketPtr &pkt) const
+BasePrefetcher::observeAccess(const PacketPtr &pkt)
 {
     Addr addr = pkt->getAddr();
     bool fetch = pkt->req->isInstFetch();
@@ -101,11 +200,28 @@ BasePrefetcher::observeAccess(const PacketPtr &pkt) const
     if (!fetch && !read && inv) return false;
     if (pkt->cmd == MemCmd::CleanEvict) return false;
 
-    if (onMiss) {
-        return !inCache(addr, is_secure) &&
-               !inMissQueue(addr, is_secure);
+    AccessSource source = accessSource(pkt);
+    // a committed load was checked when it accessed the cache, by now
+    // its line is in the cache anyway
+    bool resident = onMiss && source != CommittedLoad &&
+        (inCache(addr, is_secure) || inMissQueue(addr, is_secure));
+    bool trains = source == VisibleAccess || source == CommittedLoad ||
+        trainingPolicy == TrainAll ||
+        (source == DoppelgangerAccess &&
+         trainingPolicy == TrainDoppelganger);
+    if (!trains) {
+        // the load trains in its place if it commits
+        if (!resident)
+            pkt->setTrainDeferred();
+        pfTrainFiltered[source]++;
+        return false;
+    }
+
+    if (resident) {
+        return false;
     }
 
+    pfTrained[source]++;
     return true;
 }
 
@@ -49,10 +49,14 @@
 #ifndef __MEM_CACHE_PREFETCH_BASE_HH__
 #define __MEM_CACHE_PREFETCH_BASE_HH__
 
+#include <memory>
+#include <vector>
+
 #include "base/statistics.hh"
 #include "mem/packet.hh"
 #include "params/BasePrefetcher.hh"
 #include "sim/clocked_object.hh"
+#include "sim/probe/probe.hh"
 
 class BaseCache;
 
@@ -60,6 +64,40 @@ class BasePrefetcher : public ClockedObject
 {
   protected:
 
+    /** [STT] The accesses the prefetcher trains on */
+    enum TrainingPolicy {
+        TrainAll,
+        /** Accesses that cannot be squashed, and loads once they commit */
+        TrainVisible,
+        /** As TrainVisible, and doppelganger loads as they access */
+        TrainDoppelganger
+    };
+
+    /** [STT] What kind of access an observed packet stands for */
+    enum AccessSource {
+        VisibleAccess,
+        SquashableAccess,
+        DoppelgangerAccess,
+        CommittedLoad,
+        NumAccessSources
+    };
+
+    /** Trains the prefetcher on the loads a CPU commits */
+    class CommitListener : public ProbeListenerArgBase<PacketPtr>
+    {
+      public:
+        CommitListener(BasePrefetcher &_parent, ProbeManager *pm)
+            : ProbeListenerArgBase(pm, "CommittedLoadAccess"),
+              parent(_parent)
+        {}
+
+        void notify(const PacketPtr &pkt) override
+        { parent.trainOnCommit(pkt); }
+
+      private:
+        BasePrefetcher &parent;
+    };
+
     // PARAMETERS
 
     /** Pointr to the parent cache. */
@@ -89,13 +127,28 @@ class BasePrefetcher : public ClockedObject
     /** Consult prefetcher on instruction accesses? */
     bool onInst;
 
+    TrainingPolicy trainingPolicy;
+
+    /** CPUs whose committed loads train the prefetcher */
+    const std::vector<SimObject *> commitSources;
+
+    std::vector<std::unique_ptr<CommitListener>> commitListeners;
+
+    /** Set while a committed load is being observed */
+    bool observingCommit;
+
     /** Request id for prefetches */
     MasterID masterId;
 
     const Addr pageBytes;
 
     /** Determine if this access should be observed */
-    bool observeAccess(const PacketPtr &pkt) const;
+    bool observeAccess(const PacketPtr &pkt);
+
+    AccessSource accessSource(const PacketPtr &pkt) const;
+
+    /** Train on a committed load its access did not train on */
+    void trainOnCommit(const PacketPtr &pkt);
 
     /** Determine if address is in cache */
     bool inCache(Addr addr, bool is_secure) const;
@@ -119,6 +172,21 @@ class BasePrefetcher : public ClockedObject
 
     Stats::Scalar pfIssued;
 
+    /** Demand accesses that hit a block brought in by a prefetch */
+    Stats::Scalar pfUseful;
+    /** Demand accesses that found their prefetch still in flight */
+    Stats::Scalar pfLate;
+    /** Demand read misses no prefetch was in flight for */
+    Stats::Scalar pfDemandMisses;
+
+    Stats::Formula pfAccuracy;
+    Stats::Formula pfCoverage;
+    Stats::Formula pfLateness;
+
+    /** Accesses trained on, and left out by the policy, per source */
+    Stats::Vector pfTrained;
+    Stats::Vector pfTrainFiltered;
+
   public:
 
     BasePrefetcher(const BasePrefetcherParams *p);
@@ -138,6 +206,23 @@ class BasePrefetcher : public ClockedObject
 
     virtual Tick nextPrefetchReadyTime() const = 0;
 
+    /**
+     * Account a demand access to a block that was prefetched, either
+     * already filled or, if late, still waiting for memory.
+     */
+    void prefetchUseful(bool late)
+    {
+        if (late)
+            pfLate++;
+        else
+            pfUseful++;
+    }
+
+    /** Account a demand read miss that no prefetch covered. */
+    void demandMiss() { pfDemandMisses++; }
+
     virtual void regStats();
+
+    void regProbeListeners() override;
 };
 #endif //__MEM_CACHE_PREFETCH_BASE_HH__
@@ -0,0 +1,417 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Indirect memory prefetcher definitions.
+ */
+
+#include "mem/cache/prefetch/indirect_memory.hh"
+
+#include <algorithm>
+#include <cstring>
+
+#include "arch/isa_traits.hh"
+#include "base/intmath.hh"
+#include "base/trace.hh"
+#include "cpu/thread_context.hh"
+#include "debug/HWPrefetch.hh"
+#include "mem/cache/base.hh"
+#include "mem/page_table.hh"
+#include "sim/byteswap.hh"
+#include "sim/full_system.hh"
+#include "sim/process.hh"
+#include "sim/system.hh"
+
+IndirectMemoryPrefetcher::IndirectMemoryPrefetcher(
+    const IndirectMemoryPrefetcherParams *p)
+    : QueuedPrefetcher(p),
+      streamThresh(p->stream_thresh),
+      maxConf(p->max_conf),
+      threshConf(p->thresh_conf),
+      startConf(p->start_conf),
+      distance(p->distance),
+      missWindow(p->ipd_miss_window),
+      shifts(p->shift_values.begin(), p->shift_values.end()),
+      streamTable(p->pt_table_entries),
+      patternTable(p->ipd_table_entries),
+      tracking(nullptr), nextPattern(0), useCount(0)
+{
+    // Indices are data
+    onInst = false;
+
+    fatal_if(streamTable.empty() || patternTable.empty(),
+             "%s: the prefetch table and the pattern detector need "
+             "entries\n", name());
+    fatal_if(shifts.empty(), "%s: no shift values to try\n", name());
+
+    if (FullSystem)
+        warn("%s only translates SE mode addresses and will not "
+             "prefetch\n", name());
+}
+
+IndirectMemoryPrefetcher::StreamEntry *
+IndirectMemoryPrefetcher::findStream(Addr pc, bool is_secure)
+{
+    for (auto &entry : streamTable) {
+        if (entry.valid && entry.pc == pc && entry.isSecure == is_secure) {
+            entry.lastUse = ++useCount;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+IndirectMemoryPrefetcher::StreamEntry *
+IndirectMemoryPrefetcher::allocateStream(Addr pc, bool is_secure)
+{
+    // LRU
+    StreamEntry *victim = &streamTable[0];
+    for (auto &entry : streamTable) {
+        if (!entry.valid) {
+            victim = &entry;
+            break;
+        }
+        if (entry.lastUse < victim->lastUse)
+            victim = &entry;
+    }
+
+    // forget the pattern search of the stream replaced
+    for (auto &pattern : patternTable) {
+        if (pattern.stream == victim)
+            pattern.stream = nullptr;
+    }
+    if (tracking && !tracking->stream)
+        tracking = nullptr;
+
+    *victim = StreamEntry();
+    victim->valid = true;
+    victim->pc = pc;
+    victim->isSecure = is_secure;
+    victim->lastUse = ++useCount;
+    return victim;
+}
+
+Addr
+IndirectMemoryPrefetcher::indexOffset(int64_t index, int shift)
+{
+    return shift >= 0 ? Addr(index) << shift : Addr(index >> -shift);
+}
+
+void
+IndirectMemoryPrefetcher::searchPattern(StreamEntry *entry, int64_t index)
+{
+    PatternEntry *pattern = nullptr;
+    for (auto &p : patternTable) {
+        if (p.stream == entry)
+            pattern = &p;
+    }
+
+    if (pattern && !pattern->secondIndex && pattern->misses &&
+        index != pattern->index1) {
+        // look for the bases of the misses of index1 after index2
+        pattern->index2 = index;
+        pattern->secondIndex = true;
+        pattern->misses = 0;
+        tracking = pattern;
+        return;
+    }
+
+    if (!pattern) {
+        pattern = &patternTable[nextPattern];
+        nextPattern = (nextPattern + 1) % patternTable.size();
+    }
+
+    // (re)start from this index
+    pattern->stream = entry;
+    pattern->index1 = index;
+    pattern->secondIndex = false;
+    pattern->misses = 0;
+    pattern->bases.assign(shifts.size(), std::vector<Addr>());
+    tracking = pattern;
+}
+
+void
+IndirectMemoryPrefetcher::trainPattern(Addr vaddr)
+{
+    PatternEntry *pattern = tracking;
+    if (pattern->misses == missWindow)
+        return;
+    ++pattern->misses;
+
+    for (size_t i = 0; i < shifts.size(); ++i) {
+        int shift = shifts[i];
+        if (!pattern->secondIndex) {
+            pattern->bases[i].push_back(
+                vaddr - indexOffset(pattern->index1, shift));
+            continue;
+        }
+
+        // a repeated miss says nothing if both indices map to it
+        if (indexOffset(pattern->index1, shift) ==
+            indexOffset(pattern->index2, shift))
+            continue;
+
+        Addr base = vaddr - indexOffset(pattern->index2, shift);
+        auto &bases = pattern->bases[i];
+        if (std::find(bases.begin(), bases.end(), base) == bases.end())
+            continue;
+
+        StreamEntry *entry = pattern->stream;
+        DPRINTF(HWPrefetch, "Indirect pattern for PC %#x: base %#x "
+                "shift %d\n", entry->pc, base, shift);
+        entry->enabled = true;
+        entry->base = base;
+        entry->shift = shift;
+        entry->indirectConf = startConf;
+        entry->indexValid = false;
+        patternsFound++;
+
+        pattern->stream = nullptr;
+        tracking = nullptr;
+        return;
+    }
+}
+
+void
+IndirectMemoryPrefetcher::checkPatterns(Addr vaddr)
+{
+    for (auto &entry : streamTable) {
+        if (entry.valid && entry.enabled && entry.indexValid &&
+            !entry.matched &&
+            vaddr == entry.base + indexOffset(entry.lastIndex, entry.shift)) {
+            entry.matched = true;
+            if (entry.indirectConf < maxConf)
+                entry.indirectConf++;
+        }
+    }
+}
+
+static int64_t
+indexValue(const uint8_t *data, unsigned size)
+{
+    switch (size) {
+      case 1: {
+          int8_t v;
+          std::memcpy(&v, data, sizeof(v));
+          return v;
+      }
+      case 2: {
+          int16_t v;
+          std::memcpy(&v, data, sizeof(v));
+          return TheISA::gtoh(v);
+      }
+      case 4: {
+          int32_t v;
+          std::memcpy(&v, data, sizeof(v));
+          return TheISA::gtoh(v);
+      }
+      default: {
+          int64_t v;
+          std::memcpy(&v, data, sizeof(v));
+          return TheISA::gtoh(v);
+      }
+    }
+}
+
+bool
+IndirectMemoryPrefetcher::translate(const PacketPtr &pkt, Addr vaddr,
+                                    Addr &paddr) const
+{
+    if (FullSystem || !pkt->req->hasContextId())
+        return false;
+
+    Process *process =
+        system->getThreadContext(pkt->req->contextId())->getProcessPtr();
+    return process && process->pTable->translate(vaddr, paddr);
+}
+
+bool
+IndirectMemoryPrefetcher::readIndex(const PacketPtr &pkt, Addr vaddr,
+                                    unsigned size, int64_t &index) const
+{
+    Addr paddr;
+    if (!translate(pkt, vaddr, paddr) ||
+        blockAddress(paddr) != blockAddress(paddr + size - 1))
+        return false;
+
+    uint8_t data[sizeof(int64_t)];
+    if (!cache->peekData(paddr, pkt->isSecure(), size, data))
+        return false;
+
+    index = indexValue(data, size);
+    return true;
+}
+
+void
+IndirectMemoryPrefetcher::calculatePrefetch(const PacketPtr &pkt,
+    std::vector<AddrPriority> &addresses)
+{
+    if (!pkt->req->hasPC() || !pkt->req->hasVaddr()) {
+        DPRINTF(HWPrefetch, "Ignoring request with no PC or vaddr.\n");
+        return;
+    }
+
+    Addr vaddr = pkt->req->getVaddr();
+    Addr pc = pkt->req->getPC();
+    bool is_secure = pkt->isSecure();
+    // the cache has been accessed by now, a miss is on its way
+    bool miss = !inCache(pkt->getAddr(), is_secure);
+
+    checkPatterns(vaddr);
+
+    StreamEntry *entry = findStream(pc, is_secure);
+
+    if (miss && tracking && tracking->stream != entry)
+        trainPattern(vaddr);
+
+    if (!entry) {
+        entry = allocateStream(pc, is_secure);
+        entry->lastAddr = vaddr;
+        return;
+    }
+
+    int64_t stride = vaddr - entry->lastAddr;
+    if (stride == 0)
+        return;
+    entry->lastAddr = vaddr;
+
+    if (stride == entry->stride) {
+        if (entry->streamConf < maxConf)
+            entry->streamConf++;
+    } else {
+        entry->stride = stride;
+        entry->streamConf = 0;
+    }
+
+    if (entry->streamConf < streamThresh)
+        return;
+
+    // bring the index array in ahead of the indices the indirect
+    // prefetches need, one line at a time
+    Addr ahead = vaddr + stride * 2 * distance;
+    if (blockAddress(ahead) != blockAddress(ahead - stride)) {
+        Addr paddr;
+        if (translate(pkt, ahead, paddr)) {
+            addresses.push_back(AddrPriority(paddr, 0));
+            pfStream++;
+        } else {
+            pfNoTranslation++;
+        }
+    }
+
+    unsigned size = pkt->getSize();
+    if (miss || !pkt->isRead() ||
+        size > sizeof(int64_t) || !isPowerOf2(size))
+        return;
+
+    // the cache notifies before it responds, so the packet carries no
+    // data yet; read the index out of the block it hit instead
+    Addr addr = pkt->getAddr();
+    uint8_t data[sizeof(int64_t)];
+    if (blockAddress(addr) != blockAddress(addr + size - 1) ||
+        !cache->peekData(addr, is_secure, size, data))
+        return;
+
+    int64_t index = indexValue(data, size);
+
+    if (!entry->enabled) {
+        searchPattern(entry, index);
+        return;
+    }
+
+    // an index whose target went unaccessed counts against the pattern
+    if (entry->indexValid && !entry->matched && --entry->indirectConf <= 0) {
+        DPRINTF(HWPrefetch, "Dropping indirect pattern for PC %#x\n", pc);
+        entry->enabled = false;
+        entry->indexValid = false;
+        patternsDropped++;
+        return;
+    }
+    entry->lastIndex = index;
+    entry->indexValid = true;
+    entry->matched = false;
+
+    if (entry->indirectConf < threshConf)
+        return;
+
+    int64_t next_index;
+    if (!readIndex(pkt, vaddr + stride * distance, size, next_index)) {
+        pfIndexMissing++;
+        return;
+    }
+
+    Addr target = entry->base + indexOffset(next_index, entry->shift);
+    Addr paddr;
+    if (!translate(pkt, target, paddr)) {
+        pfNoTranslation++;
+        return;
+    }
+
+    DPRINTF(HWPrefetch, "Indirect prefetch for PC %#x: index %d, "
+            "target %#x\n", pc, next_index, target);
+    addresses.push_back(AddrPriority(paddr, 0));
+    pfIndirect++;
+}
+
+void
+IndirectMemoryPrefetcher::regStats()
+{
+    QueuedPrefetcher::regStats();
+
+    patternsFound
+        .name(name() + ".patternsFound")
+        .desc("number of indirect patterns found for index streams");
+
+    patternsDropped
+        .name(name() + ".patternsDropped")
+        .desc("number of indirect patterns dropped for lack of confidence");
+
+    pfStream
+        .name(name() + ".pfStream")
+        .desc("number of prefetches of index array lines");
+
+    pfIndirect
+        .name(name() + ".pfIndirect")
+        .desc("number of prefetches of indirect targets");
+
+    pfIndexMissing
+        .name(name() + ".pfIndexMissing")
+        .desc("number of indirect prefetches dropped as the index to "
+              "follow was not in the cache");
+
+    pfNoTranslation
+        .name(name() + ".pfNoTranslation")
+        .desc("number of prefetches dropped for lack of a translation");
+}
+
+IndirectMemoryPrefetcher*
+IndirectMemoryPrefetcherParams::create()
+{
+    return new IndirectMemoryPrefetcher(this);
+}
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Describes an indirect memory prefetcher, after IMP (Yu et al., MICRO
+ * 2015).
+ */
+
+#ifndef __MEM_CACHE_PREFETCH_INDIRECT_MEMORY_HH__
+#define __MEM_CACHE_PREFETCH_INDIRECT_MEMORY_HH__
+
+#include <vector>
+
+#include "mem/cache/prefetch/queued.hh"
+#include "params/IndirectMemoryPrefetcher.hh"
+
+/**
+ * Prefetches the targets of indirect accesses A[B[i]] that walk an index
+ * array B, as in the neighbour loops of graph kernels.
+ *
+ * The prefetch table keeps one index stream per load PC. Once a stream
+ * has a stable stride, the prefetcher looks for the indirect access that
+ * goes with it: after each index read by the stream, the misses that
+ * follow give candidate bases miss - (index << shift), one per shift
+ * tried, and a base that shows up again after the next index read
+ * becomes the pattern of the stream. From then on every index read makes
+ * the prefetcher read B[i + distance] out of the cache and prefetch
+ * base + (B[i + distance] << shift), while the lines of the index array
+ * are streamed in further ahead so that the index is usually there.
+ *
+ * The patterns are found on virtual addresses, the only ones in which
+ * A is contiguous, so the prefetcher relies on the request's virtual
+ * address and on the page table of the process to translate what it
+ * prefetches; it only works in SE mode. It reads the indices out of the
+ * data of the access, so it belongs to the L1 data cache.
+ */
+class IndirectMemoryPrefetcher : public QueuedPrefetcher
+{
+  protected:
+    /** An index stream, and the indirect pattern found for it */
+    struct StreamEntry
+    {
+        StreamEntry() : valid(false), pc(0), isSecure(false), lastAddr(0),
+                        stride(0), streamConf(0), enabled(false), base(0),
+                        shift(0), indirectConf(0), lastIndex(0),
+                        indexValid(false), matched(false), lastUse(0)
+        { }
+
+        bool valid;
+        Addr pc;
+        bool isSecure;
+
+        /** Virtual address of the last index read by the PC */
+        Addr lastAddr;
+        int64_t stride;
+        int streamConf;
+
+        /** An indirect pattern has been found for the stream */
+        bool enabled;
+        Addr base;
+        int shift;
+        int indirectConf;
+
+        /** The last index read, and if its target has been accessed */
+        int64_t lastIndex;
+        bool indexValid;
+        bool matched;
+
+        uint64_t lastUse;
+    };
+
+    /** The search for the indirect pattern of one stream */
+    struct PatternEntry
+    {
+        PatternEntry() : stream(nullptr), index1(0), index2(0),
+                         secondIndex(false), misses(0)
+        { }
+
+        StreamEntry *stream;
+        int64_t index1;
+        int64_t index2;
+        bool secondIndex;
+
+        /** Candidate bases after index1, per shift */
+        std::vector<std::vector<Addr>> bases;
+
+        /** Misses seen since the last index read */
+        unsigned misses;
+    };
+
+    const int streamThresh;
+    const int maxConf;
+    const int threshConf;
+    const int startConf;
+
+    /** Index array elements the indirect prefetches run ahead */
+    const unsigned distance;
+
+    /** Misses after an index read that may be its indirect access */
+    const unsigned missWindow;
+
+    /** log2 of the element sizes of A tried, negative ones divide */
+    const std::vector<int> shifts;
+
+    std::vector<StreamEntry> streamTable;
+    std::vector<PatternEntry> patternTable;
+
+    /** The pattern search the misses are attributed to, if any */
+    PatternEntry *tracking;
+
+    /** Round robin victim of the pattern table */
+    unsigned nextPattern;
+
+    uint64_t useCount;
+
+    StreamEntry *findStream(Addr pc, bool is_secure);
+    StreamEntry *allocateStream(Addr pc, bool is_secure);
+
+    /** Start or continue the pattern search of a stream with an index */
+    void searchPattern(StreamEntry *entry, int64_t index);
+
+    /** Match a miss against the pattern being searched */
+    void trainPattern(Addr vaddr);
+
+    /** Confirm the patterns whose last target is being accessed */
+    void checkPatterns(Addr vaddr);
+
+    static Addr indexOffset(int64_t index, int shift);
+
+    /** Read an index out of the cache, by virtual address */
+    bool readIndex(const PacketPtr &pkt, Addr vaddr, unsigned size,
+                   int64_t &index) const;
+
+    /** Translate with the page table of the process of the access */
+    bool translate(const PacketPtr &pkt, Addr vaddr, Addr &paddr) const;
+
+    Stats::Scalar patternsFound;
+    Stats::Scalar patternsDropped;
+    Stats::Scalar pfStream;
+    Stats::Scalar pfIndirect;
+    Stats::Scalar pfIndexMissing;
+    Stats::Scalar pfNoTranslation;
+
+  public:
+
+    IndirectMemoryPrefetcher(const IndirectMemoryPrefetcherParams *p);
+
+    void calculatePrefetch(const PacketPtr &pkt,
+                           std::vector<AddrPriority> &addresses);
+
+    void regStats();
+};
+
+#endif // __MEM_CACHE_PREFETCH_INDIRECT_MEMORY_HH__
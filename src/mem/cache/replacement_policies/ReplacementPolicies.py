@@ -0,0 +1,85 @@
+# Copyright (c) 2026
+# All rights reserved.
+#
+#
+# Redistribution and use in source and binary forms, with or without
+# modification, are permitted provided that the following conditions are
+# met: redistributions of source code must retain the above copyright
+# notice, this list of conditions and the following disclaimer;
+# redistributions in binary form must reproduce the above copyright
+# notice, this list of conditions and the following disclaimer in the
+# documentation and/or other materials provided with the distribution;
+# neither the name of the copyright holders nor the names of its
+# contributors may be used to endorse or promote products derived from
+# this software without specific prior written permission.
+#
+# THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+# "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+# LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+# A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+# OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+# SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+# LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+# DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+# THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+# (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+# OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+from m5.params import *
+from m5.SimObject import SimObject
+
+# Replacement policies of the SetAssoc tags, see
+# mem/cache/replacement_policies/base.hh.
+class BaseReplacementPolicy(SimObject):
+    type = 'BaseReplacementPolicy'
+    abstract = True
+    cxx_header = "mem/cache/replacement_policies/base.hh"
+
+class LRURP(BaseReplacementPolicy):
+    type = 'LRURP'
+    cxx_class = 'LRURP'
+    cxx_header = "mem/cache/replacement_policies/lru_rp.hh"
+
+class BRRIPRP(BaseReplacementPolicy):
+    type = 'BRRIPRP'
+    cxx_class = 'BRRIPRP'
+    cxx_header = "mem/cache/replacement_policies/brrip_rp.hh"
+    num_bits = Param.Int(2, "Number of bits of the re-reference "
+                         "prediction values")
+    hit_priority = Param.Bool(False, "Predict a near re-reference on a "
+                              "hit, rather than only a nearer one")
+    btp = Param.Percent(3, "Percentage of insertions predicted long rather "
+                        "than distant re-reference")
+
+class SRRIPRP(BRRIPRP):
+    btp = 100
+
+class DRRIPRP(BRRIPRP):
+    type = 'DRRIPRP'
+    cxx_class = 'DRRIPRP'
+    cxx_header = "mem/cache/replacement_policies/drrip_rp.hh"
+    constituency_size = Param.Unsigned(32, "Sets per constituency, each "
+                                       "with one SRRIP and one BRRIP "
+                                       "leader set")
+    psel_bits = Param.Unsigned(10, "Number of bits of the policy selector")
+
+class SHiPRP(BRRIPRP):
+    type = 'SHiPRP'
+    cxx_class = 'SHiPRP'
+    cxx_header = "mem/cache/replacement_policies/ship_rp.hh"
+    btp = 100
+    shct_entries = Param.Unsigned(16384, "Number of entries of the "
+                                  "signature history counter table")
+    shct_bits = Param.Unsigned(3, "Number of bits of the SHCT counters")
+
+class HawkeyeRP(BaseReplacementPolicy):
+    type = 'HawkeyeRP'
+    cxx_class = 'HawkeyeRP'
+    cxx_header = "mem/cache/replacement_policies/hawkeye_rp.hh"
+    sampled_sets = Param.Unsigned(64, "Number of sets OPTgen samples")
+    history_factor = Param.Unsigned(8, "Length of the OPTgen history, in "
+                                    "multiples of the associativity")
+    predictor_entries = Param.Unsigned(8192, "Number of entries of the "
+                                       "PC-indexed predictor")
+    predictor_bits = Param.Unsigned(3, "Number of bits of the predictor "
+                                    "counters")
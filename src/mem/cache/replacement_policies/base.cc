@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions shared by the replacement policies.
+ */
+
+#include "mem/cache/replacement_policies/base.hh"
+
+#include "base/logging.hh"
+
+BaseReplacementPolicy::BaseReplacementPolicy(const Params *p)
+    : SimObject(p), numSets(0), assoc(0)
+{
+}
+
+void
+BaseReplacementPolicy::setGeometry(unsigned num_sets, unsigned set_assoc)
+{
+    fatal_if(numSets != 0, "%s: a replacement policy can only serve one "
+             "tag store", name());
+    numSets = num_sets;
+    assoc = set_assoc;
+}
+
+unsigned
+BaseReplacementPolicy::counterBits(int bits, int max_bits,
+                                   const char *what) const
+{
+    fatal_if(bits <= 0 || bits > max_bits,
+             "%s: %s must have between 1 and %d bits", name(), what,
+             max_bits);
+    return bits;
+}
+
+unsigned
+BaseReplacementPolicy::signature(Addr pc, unsigned entries)
+{
+    // fold the upper bits in, instructions are often aligned
+    return (pc ^ (pc >> 2) ^ (pc >> 16)) % entries;
+}
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the interface of the replacement policies of the
+ * SetAssoc tags.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
+
+#include <memory>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/cache/blk.hh"
+#include "mem/packet.hh"
+#include "params/BaseReplacementPolicy.hh"
+#include "sim/sim_object.hh"
+
+/**
+ * What a replacement policy keeps about a block. Each policy derives its
+ * own, and the tags hold one per block in CacheBlk::replacementData.
+ */
+struct ReplacementData {
+    virtual ~ReplacementData() {}
+};
+
+/** The blocks a victim may be chosen from, in way order */
+typedef std::vector<CacheBlk*> ReplacementCandidates;
+
+/**
+ * A replacement policy decides which block of a set to evict, from what
+ * it keeps in the replacement data of the blocks. The tags tell it about
+ * every hit, fill and invalidation, along with the packet of the access
+ * when there is one, so that a policy may also learn from the requester.
+ *
+ * A policy serves a single tag store, whose geometry it is given before
+ * any access.
+ */
+class BaseReplacementPolicy : public SimObject
+{
+  protected:
+    unsigned numSets;
+    unsigned assoc;
+
+    /** The PC of the access, or 0 if there is none */
+    static Addr
+    accessPC(const PacketPtr pkt)
+    {
+        return pkt && pkt->req->hasPC() ? pkt->req->getPC() : 0;
+    }
+
+    /** Hash a PC into a table index of the given size */
+    static unsigned signature(Addr pc, unsigned entries);
+
+    /**
+     * Check the width of a counter parameter, so that it can be shifted
+     * by in a member initializer.
+     * @param bits The parameter value.
+     * @param max_bits The widest counter the policy supports.
+     * @param what The counter, for the error message.
+     * @return bits, if it is between 1 and max_bits.
+     */
+    unsigned counterBits(int bits, int max_bits, const char *what) const;
+
+  public:
+    typedef BaseReplacementPolicyParams Params;
+
+    BaseReplacementPolicy(const Params *p);
+
+    virtual ~BaseReplacementPolicy() {}
+
+    /**
+     * Called by the tags once, before any access.
+     * @param num_sets The number of sets of the tag store.
+     * @param set_assoc The associativity of the tag store.
+     */
+    virtual void setGeometry(unsigned num_sets, unsigned set_assoc);
+
+    /**
+     * A block leaves the cache, by eviction or invalidation. Its data
+     * should make it a preferred victim.
+     * @param blk The block, still holding its tag.
+     */
+    virtual void invalidate(CacheBlk *blk) = 0;
+
+    /**
+     * An access hits on a block.
+     * @param blk The block.
+     * @param pkt The access, or nullptr if unknown.
+     */
+    virtual void touch(CacheBlk *blk, const PacketPtr pkt) = 0;
+
+    /**
+     * A block has been filled with a new tag.
+     * @param blk The block, with its new tag.
+     * @param pkt The access that caused the fill.
+     */
+    virtual void reset(CacheBlk *blk, const PacketPtr pkt) = 0;
+
+    /**
+     * Choose a victim among valid blocks.
+     * @param candidates The blocks of the set that may be replaced.
+     * @return The victim.
+     */
+    virtual CacheBlk* getVictim(const ReplacementCandidates &candidates) = 0;
+
+    /** Make the replacement data of one block */
+    virtual std::shared_ptr<ReplacementData> instantiateEntry() = 0;
+};
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_BASE_HH__
@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of the bimodal and static re-reference interval prediction
+ * replacement policies.
+ */
+
+#include "mem/cache/replacement_policies/brrip_rp.hh"
+
+#include <cassert>
+
+#include "base/logging.hh"
+#include "base/random.hh"
+
+BRRIPRP::BRRIPRP(const Params *p)
+    : BaseReplacementPolicy(p),
+      maxRRPV((1 << counterBits(p->num_bits, 8, "RRPVs")) - 1),
+      hitPriority(p->hit_priority), btp(p->btp)
+{
+}
+
+unsigned
+BRRIPRP::bimodalRRPV() const
+{
+    return random_mt.random<unsigned>(1, 100) <= btp ? maxRRPV - 1 : maxRRPV;
+}
+
+void
+BRRIPRP::insert(CacheBlk *blk, unsigned rrpv)
+{
+    auto data = std::static_pointer_cast<BRRIPReplData>(blk->replacementData);
+    data->rrpv = rrpv;
+    data->valid = true;
+}
+
+void
+BRRIPRP::invalidate(CacheBlk *blk)
+{
+    auto data = std::static_pointer_cast<BRRIPReplData>(blk->replacementData);
+    data->rrpv = maxRRPV;
+    data->valid = false;
+}
+
+void
+BRRIPRP::touch(CacheBlk *blk, const PacketPtr pkt)
+{
+    auto data = std::static_pointer_cast<BRRIPReplData>(blk->replacementData);
+    if (hitPriority)
+        data->rrpv = 0;
+    else if (data->rrpv > 0)
+        data->rrpv--;
+}
+
+void
+BRRIPRP::reset(CacheBlk *blk, const PacketPtr pkt)
+{
+    insert(blk, bimodalRRPV());
+}
+
+CacheBlk*
+BRRIPRP::getVictim(const ReplacementCandidates &candidates)
+{
+    assert(!candidates.empty());
+
+    CacheBlk *victim = candidates[0];
+    unsigned victim_rrpv = 0;
+    for (CacheBlk *blk : candidates) {
+        auto data =
+            std::static_pointer_cast<BRRIPReplData>(blk->replacementData);
+        if (!data->valid)
+            return blk;
+        if (data->rrpv > victim_rrpv) {
+            victim = blk;
+            victim_rrpv = data->rrpv;
+        }
+    }
+
+    // age the set as if it had been searched until a block got distant
+    unsigned age = maxRRPV - victim_rrpv;
+    if (age > 0) {
+        for (CacheBlk *blk : candidates) {
+            std::static_pointer_cast<BRRIPReplData>(
+                blk->replacementData)->rrpv += age;
+        }
+    }
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+BRRIPRP::instantiateEntry()
+{
+    return std::make_shared<BRRIPReplData>();
+}
+
+BRRIPRP*
+BRRIPRPParams::create()
+{
+    return new BRRIPRP(this);
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the bimodal and static re-reference interval prediction
+ * replacement policies (Jaleel et al., ISCA 2010).
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_BRRIP_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_BRRIP_RP_HH__
+
+#include "mem/cache/replacement_policies/base.hh"
+#include "params/BRRIPRP.hh"
+
+/**
+ * Each block has a re-reference prediction value (RRPV); the victim is a
+ * block predicted to be re-referenced in the distant future, i.e. with
+ * the maximum RRPV, and all the blocks of the set age until there is
+ * one. A hit predicts a near re-reference.
+ *
+ * BRRIP inserts most blocks with a distant prediction, and btp percent
+ * of them with a long one, so a working set larger than the cache keeps
+ * part of itself cached instead of thrashing. With btp at 100 every
+ * block is inserted long, which is SRRIP.
+ */
+class BRRIPRP : public BaseReplacementPolicy
+{
+  protected:
+    struct BRRIPReplData : ReplacementData
+    {
+        BRRIPReplData() : rrpv(0), valid(false) {}
+
+        /** The re-reference prediction value */
+        unsigned rrpv;
+
+        bool valid;
+    };
+
+    /** The distant re-reference prediction, all bits set */
+    const unsigned maxRRPV;
+
+    /** Whether a hit predicts a near re-reference or only a nearer one */
+    const bool hitPriority;
+
+    /** Percentage of the insertions predicted long */
+    const unsigned btp;
+
+    /** The RRPV of an insertion by the bimodal throttle */
+    unsigned bimodalRRPV() const;
+
+    /** Insert a block with the given prediction */
+    void insert(CacheBlk *blk, unsigned rrpv);
+
+  public:
+    typedef BRRIPRPParams Params;
+
+    BRRIPRP(const Params *p);
+
+    void invalidate(CacheBlk *blk) override;
+    void touch(CacheBlk *blk, const PacketPtr pkt) override;
+    void reset(CacheBlk *blk, const PacketPtr pkt) override;
+    CacheBlk* getVictim(const ReplacementCandidates &candidates) override;
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+};
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_BRRIP_RP_HH__
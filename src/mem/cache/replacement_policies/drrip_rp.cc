@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of the dynamic re-reference interval prediction replacement
+ * policy.
+ */
+
+#include "mem/cache/replacement_policies/drrip_rp.hh"
+
+#include "base/logging.hh"
+
+DRRIPRP::DRRIPRP(const Params *p)
+    : BRRIPRP(p), constituencySize(p->constituency_size),
+      psel(1 << (counterBits(p->psel_bits, 31, "PSEL") - 1)),
+      pselMax((1 << p->psel_bits) - 1)
+{
+    fatal_if(constituencySize < 2, "%s: a constituency needs at least "
+             "two sets for the leaders", name());
+}
+
+void
+DRRIPRP::setGeometry(unsigned num_sets, unsigned set_assoc)
+{
+    BRRIPRP::setGeometry(num_sets, set_assoc);
+    fatal_if(numSets < constituencySize, "%s: %d sets are fewer than a "
+             "constituency of %d", name(), numSets, constituencySize);
+}
+
+void
+DRRIPRP::reset(CacheBlk *blk, const PacketPtr pkt)
+{
+    const unsigned offset = blk->set % constituencySize;
+    if (offset == 0) {
+        // SRRIP leader
+        if (psel < pselMax)
+            psel++;
+        insert(blk, maxRRPV - 1);
+    } else if (offset == constituencySize / 2) {
+        // BRRIP leader
+        if (psel > 0)
+            psel--;
+        insert(blk, bimodalRRPV());
+    } else if (psel > pselMax / 2) {
+        brripFills++;
+        insert(blk, bimodalRRPV());
+    } else {
+        srripFills++;
+        insert(blk, maxRRPV - 1);
+    }
+}
+
+void
+DRRIPRP::regStats()
+{
+    BRRIPRP::regStats();
+
+    srripFills
+        .name(name() + ".srripFills")
+        .desc("number of fills of follower sets inserted as SRRIP");
+
+    brripFills
+        .name(name() + ".brripFills")
+        .desc("number of fills of follower sets inserted as BRRIP");
+}
+
+DRRIPRP*
+DRRIPRPParams::create()
+{
+    return new DRRIPRP(this);
+}
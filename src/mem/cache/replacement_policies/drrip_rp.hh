@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the dynamic re-reference interval prediction replacement
+ * policy.
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_DRRIP_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_DRRIP_RP_HH__
+
+#include "base/statistics.hh"
+#include "mem/cache/replacement_policies/brrip_rp.hh"
+#include "params/DRRIPRP.hh"
+
+/**
+ * Chooses between SRRIP and BRRIP insertion by set dueling. Every
+ * constituency of constituency_size sets has a leader set that always
+ * inserts as SRRIP and one that always inserts as BRRIP; a fill in a
+ * leader set is a miss of its policy and moves the policy selector
+ * (PSEL) against it. The follower sets insert as the policy that misses
+ * less.
+ */
+class DRRIPRP : public BRRIPRP
+{
+  protected:
+    const unsigned constituencySize;
+
+    /** The saturating policy selector, high when SRRIP misses more */
+    unsigned psel;
+    const unsigned pselMax;
+
+    Stats::Scalar srripFills;
+    Stats::Scalar brripFills;
+
+  public:
+    typedef DRRIPRPParams Params;
+
+    DRRIPRP(const Params *p);
+
+    void setGeometry(unsigned num_sets, unsigned set_assoc) override;
+    void reset(CacheBlk *blk, const PacketPtr pkt) override;
+
+    void regStats() override;
+};
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_DRRIP_RP_HH__
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of a replacement policy after Hawkeye.
+ */
+
+#include "mem/cache/replacement_policies/hawkeye_rp.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/logging.hh"
+
+HawkeyeRP::HawkeyeRP(const Params *p)
+    : BaseReplacementPolicy(p), sampledSets(p->sampled_sets),
+      historyFactor(p->history_factor), historyLength(0), samplePeriod(1),
+      friendlyThreshold(
+          1 << (counterBits(p->predictor_bits, 8,
+                            "predictor counters") - 1)),
+      accessCount(0)
+{
+    fatal_if(sampledSets == 0, "%s: OPTgen needs sampled sets", name());
+    fatal_if(historyFactor == 0, "%s: OPTgen needs a history", name());
+    fatal_if(p->predictor_entries == 0, "%s: the predictor needs entries",
+             name());
+    // unknown PCs start as weakly friendly
+    predictor.resize(p->predictor_entries,
+                     SatCounter(p->predictor_bits, friendlyThreshold));
+}
+
+void
+HawkeyeRP::setGeometry(unsigned num_sets, unsigned set_assoc)
+{
+    BaseReplacementPolicy::setGeometry(num_sets, set_assoc);
+
+    historyLength = historyFactor * assoc;
+    samplePeriod = std::max(1u, numSets / sampledSets);
+
+    optGens.resize((numSets + samplePeriod - 1) / samplePeriod);
+    for (auto &opt : optGens) {
+        opt.occupancy.assign(historyLength, 0);
+        opt.history.assign(historyLength, SampledAccess());
+        opt.time = 0;
+    }
+}
+
+void
+HawkeyeRP::train(const CacheBlk *blk, unsigned sig)
+{
+    if (blk->set % samplePeriod != 0)
+        return;
+
+    OptGen &opt = optGens[blk->set / samplePeriod];
+    const uint64_t now = opt.time;
+    const uint64_t oldest = now < historyLength ? 0 : now - historyLength + 1;
+    optAccesses++;
+
+    // look for the previous access of the block within the history
+    for (uint64_t t = now; t-- > oldest; ) {
+        SampledAccess &prev = opt.history[t % historyLength];
+        if (!prev.valid || prev.tag != blk->tag)
+            continue;
+
+        // OPT kept the block if the set always had room for it
+        bool opt_hit = true;
+        for (uint64_t u = t; u < now; ++u) {
+            if (opt.occupancy[u % historyLength] >= assoc) {
+                opt_hit = false;
+                break;
+            }
+        }
+
+        if (opt_hit) {
+            for (uint64_t u = t; u < now; ++u)
+                opt.occupancy[u % historyLength]++;
+            predictor[prev.signature].increment();
+            optHits++;
+        } else {
+            predictor[prev.signature].decrement();
+        }
+        prev.reused = true;
+        break;
+    }
+
+    // the access leaving the history was never reused, OPT dropped it
+    SampledAccess &slot = opt.history[now % historyLength];
+    if (slot.valid && !slot.reused)
+        predictor[slot.signature].decrement();
+
+    slot.tag = blk->tag;
+    slot.signature = sig;
+    slot.valid = true;
+    slot.reused = false;
+    opt.occupancy[now % historyLength] = 0;
+    opt.time++;
+}
+
+void
+HawkeyeRP::access(CacheBlk *blk, const PacketPtr pkt)
+{
+    auto data =
+        std::static_pointer_cast<HawkeyeReplData>(blk->replacementData);
+    const unsigned sig = signature(accessPC(pkt), predictor.size());
+
+    train(blk, sig);
+
+    data->valid = true;
+    data->friendly = predictor[sig].read() >= friendlyThreshold;
+    data->signature = sig;
+    data->lastTouch = ++accessCount;
+}
+
+void
+HawkeyeRP::invalidate(CacheBlk *blk)
+{
+    auto data =
+        std::static_pointer_cast<HawkeyeReplData>(blk->replacementData);
+    data->valid = false;
+    data->friendly = false;
+}
+
+void
+HawkeyeRP::touch(CacheBlk *blk, const PacketPtr pkt)
+{
+    access(blk, pkt);
+}
+
+void
+HawkeyeRP::reset(CacheBlk *blk, const PacketPtr pkt)
+{
+    access(blk, pkt);
+
+    if (std::static_pointer_cast<HawkeyeReplData>(
+            blk->replacementData)->friendly) {
+        friendlyFills++;
+    } else {
+        averseFills++;
+    }
+}
+
+CacheBlk*
+HawkeyeRP::getVictim(const ReplacementCandidates &candidates)
+{
+    assert(!candidates.empty());
+
+    CacheBlk *victim = nullptr;
+    uint64_t oldest = 0;
+    for (CacheBlk *blk : candidates) {
+        auto data =
+            std::static_pointer_cast<HawkeyeReplData>(blk->replacementData);
+        if (!data->valid || !data->friendly)
+            return blk;
+        if (!victim || data->lastTouch < oldest) {
+            victim = blk;
+            oldest = data->lastTouch;
+        }
+    }
+
+    // a friendly block has to go, so its PC was too optimistic
+    friendlyEvictions++;
+    predictor[std::static_pointer_cast<HawkeyeReplData>(
+        victim->replacementData)->signature].decrement();
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+HawkeyeRP::instantiateEntry()
+{
+    return std::make_shared<HawkeyeReplData>();
+}
+
+void
+HawkeyeRP::regStats()
+{
+    BaseReplacementPolicy::regStats();
+
+    optAccesses
+        .name(name() + ".optAccesses")
+        .desc("number of accesses to the sampled sets replayed by OPTgen");
+
+    optHits
+        .name(name() + ".optHits")
+        .desc("number of sampled accesses that hit under Belady's OPT");
+
+    optHitRate
+        .name(name() + ".optHitRate")
+        .desc("hit rate of Belady's OPT on the sampled sets");
+    optHitRate = optHits / optAccesses;
+
+    friendlyFills
+        .name(name() + ".friendlyFills")
+        .desc("number of fills predicted cache-friendly");
+
+    averseFills
+        .name(name() + ".averseFills")
+        .desc("number of fills predicted cache-averse");
+
+    friendlyEvictions
+        .name(name() + ".friendlyEvictions")
+        .desc("number of evictions of blocks predicted cache-friendly");
+}
+
+HawkeyeRP*
+HawkeyeRPParams::create()
+{
+    return new HawkeyeRP(this);
+}
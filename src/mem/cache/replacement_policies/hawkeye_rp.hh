@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a replacement policy after Hawkeye (Jain and Lin,
+ * ISCA 2016).
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_HAWKEYE_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_HAWKEYE_RP_HH__
+
+#include <vector>
+
+#include "base/statistics.hh"
+#include "cpu/pred/sat_counter.hh"
+#include "mem/cache/replacement_policies/base.hh"
+#include "params/HawkeyeRP.hh"
+
+/**
+ * Learns from Belady's optimal policy which PCs fill blocks worth
+ * keeping. On a few sampled sets OPTgen replays the accesses and tells,
+ * when a block is accessed again, whether OPT would have kept it since
+ * its previous access: it would if the set never held assoc other live
+ * blocks in between. The PC of the previous access is trained towards
+ * cache-friendly if so and cache-averse otherwise, and so is a PC whose
+ * block is not accessed again within the history.
+ *
+ * Every hit and fill is predicted by its PC. Averse blocks are evicted
+ * first; when the set has none, the least recently used friendly block
+ * goes and its PC is trained towards averse, since it was mispredicted.
+ * This orders the friendly blocks by recency rather than by aging RRPVs
+ * on every friendly fill, which would need the whole set at each fill.
+ */
+class HawkeyeRP : public BaseReplacementPolicy
+{
+  protected:
+    struct HawkeyeReplData : ReplacementData
+    {
+        HawkeyeReplData()
+            : valid(false), friendly(false), signature(0), lastTouch(0)
+        { }
+
+        bool valid;
+        bool friendly;
+
+        /** The signature of the PC of the last access */
+        unsigned signature;
+
+        /** Access count of the last access, for recency */
+        uint64_t lastTouch;
+    };
+
+    /** An access in the history of a sampled set */
+    struct SampledAccess
+    {
+        SampledAccess() : tag(0), signature(0), valid(false), reused(false)
+        { }
+
+        Addr tag;
+        unsigned signature;
+        bool valid;
+
+        /** The block has been accessed again within the history */
+        bool reused;
+    };
+
+    /** OPTgen of one sampled set, over a ring of historyLength accesses */
+    struct OptGen
+    {
+        /** Live blocks across each access slot under OPT */
+        std::vector<unsigned> occupancy;
+        std::vector<SampledAccess> history;
+
+        /** Number of accesses so far */
+        uint64_t time;
+    };
+
+    const unsigned sampledSets;
+    const unsigned historyFactor;
+
+    /** Accesses OPTgen looks back over, set with the geometry */
+    unsigned historyLength;
+
+    /** Every samplePeriod-th set is sampled */
+    unsigned samplePeriod;
+
+    std::vector<OptGen> optGens;
+
+    std::vector<SatCounter> predictor;
+
+    /** Predictor counters at or above it are friendly */
+    const uint8_t friendlyThreshold;
+
+    uint64_t accessCount;
+
+    /** Replay an access in OPTgen if its set is sampled */
+    void train(const CacheBlk *blk, unsigned sig);
+
+    /** Train, predict and update the data of an accessed block */
+    void access(CacheBlk *blk, const PacketPtr pkt);
+
+    Stats::Scalar optAccesses;
+    Stats::Scalar optHits;
+    Stats::Formula optHitRate;
+    Stats::Scalar friendlyFills;
+    Stats::Scalar averseFills;
+    Stats::Scalar friendlyEvictions;
+
+  public:
+    typedef HawkeyeRPParams Params;
+
+    HawkeyeRP(const Params *p);
+
+    void setGeometry(unsigned num_sets, unsigned set_assoc) override;
+
+    void invalidate(CacheBlk *blk) override;
+    void touch(CacheBlk *blk, const PacketPtr pkt) override;
+    void reset(CacheBlk *blk, const PacketPtr pkt) override;
+    CacheBlk* getVictim(const ReplacementCandidates &candidates) override;
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    void regStats() override;
+};
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_HAWKEYE_RP_HH__
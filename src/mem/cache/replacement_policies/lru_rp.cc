@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of a least recently used replacement policy.
+ */
+
+#include "mem/cache/replacement_policies/lru_rp.hh"
+
+#include <cassert>
+
+#include "sim/core.hh"
+
+LRURP::LRURP(const Params *p)
+    : BaseReplacementPolicy(p)
+{
+}
+
+void
+LRURP::invalidate(CacheBlk *blk)
+{
+    std::static_pointer_cast<LRUReplData>(
+        blk->replacementData)->lastTouchTick = 0;
+}
+
+void
+LRURP::touch(CacheBlk *blk, const PacketPtr pkt)
+{
+    std::static_pointer_cast<LRUReplData>(
+        blk->replacementData)->lastTouchTick = curTick();
+}
+
+void
+LRURP::reset(CacheBlk *blk, const PacketPtr pkt)
+{
+    touch(blk, pkt);
+}
+
+CacheBlk*
+LRURP::getVictim(const ReplacementCandidates &candidates)
+{
+    assert(!candidates.empty());
+
+    CacheBlk *victim = candidates[0];
+    Tick oldest = MaxTick;
+    for (CacheBlk *blk : candidates) {
+        Tick last = std::static_pointer_cast<LRUReplData>(
+            blk->replacementData)->lastTouchTick;
+        if (last < oldest) {
+            victim = blk;
+            oldest = last;
+        }
+    }
+    return victim;
+}
+
+std::shared_ptr<ReplacementData>
+LRURP::instantiateEntry()
+{
+    return std::make_shared<LRUReplData>();
+}
+
+LRURP*
+LRURPParams::create()
+{
+    return new LRURP(this);
+}
@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of the signature-based hit predictor replacement policy.
+ */
+
+#include "mem/cache/replacement_policies/ship_rp.hh"
+
+#include "base/logging.hh"
+
+SHiPRP::SHiPRP(const Params *p)
+    : BRRIPRP(p)
+{
+    fatal_if(p->shct_entries == 0, "%s: the SHCT needs entries", name());
+    const unsigned bits = counterBits(p->shct_bits, 8, "SHCT counters");
+    // start every signature halfway, neither reused nor dead
+    shct.resize(p->shct_entries, SatCounter(bits, 1 << (bits - 1)));
+}
+
+void
+SHiPRP::invalidate(CacheBlk *blk)
+{
+    auto data = std::static_pointer_cast<SHiPReplData>(blk->replacementData);
+    if (data->valid && !data->outcome)
+        shct[data->signature].decrement();
+    BRRIPRP::invalidate(blk);
+}
+
+void
+SHiPRP::touch(CacheBlk *blk, const PacketPtr pkt)
+{
+    auto data = std::static_pointer_cast<SHiPReplData>(blk->replacementData);
+    data->outcome = true;
+    shct[data->signature].increment();
+    BRRIPRP::touch(blk, pkt);
+}
+
+void
+SHiPRP::reset(CacheBlk *blk, const PacketPtr pkt)
+{
+    auto data = std::static_pointer_cast<SHiPReplData>(blk->replacementData);
+    data->signature = signature(accessPC(pkt), shct.size());
+    data->outcome = false;
+
+    if (shct[data->signature].read() == 0) {
+        distantFills++;
+        insert(blk, maxRRPV);
+    } else {
+        insert(blk, bimodalRRPV());
+    }
+}
+
+std::shared_ptr<ReplacementData>
+SHiPRP::instantiateEntry()
+{
+    return std::make_shared<SHiPReplData>();
+}
+
+void
+SHiPRP::regStats()
+{
+    BRRIPRP::regStats();
+
+    distantFills
+        .name(name() + ".distantFills")
+        .desc("number of fills predicted dead by their signature");
+}
+
+SHiPRP*
+SHiPRPParams::create()
+{
+    return new SHiPRP(this);
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of the signature-based hit predictor replacement policy
+ * (Wu et al., MICRO 2011).
+ */
+
+#ifndef __MEM_CACHE_REPLACEMENT_POLICIES_SHIP_RP_HH__
+#define __MEM_CACHE_REPLACEMENT_POLICIES_SHIP_RP_HH__
+
+#include <vector>
+
+#include "base/statistics.hh"
+#include "cpu/pred/sat_counter.hh"
+#include "mem/cache/replacement_policies/brrip_rp.hh"
+#include "params/SHiPRP.hh"
+
+/**
+ * RRIP whose insertion is predicted from the PC of the fill. The
+ * signature history counter table (SHCT) counts, per PC signature,
+ * whether the blocks it filled were hit before they left: a hit
+ * increments the counter of the block's signature, and an eviction
+ * without a hit decrements it. Blocks from a signature whose counter is
+ * zero are inserted with a distant prediction, the others as the
+ * underlying RRIP would.
+ *
+ * Fills without a PC, such as writebacks, share the signature of PC 0.
+ */
+class SHiPRP : public BRRIPRP
+{
+  protected:
+    struct SHiPReplData : BRRIPReplData
+    {
+        SHiPReplData() : signature(0), outcome(false) {}
+
+        /** The signature of the PC that filled the block */
+        unsigned signature;
+
+        /** Whether the block has been hit since its fill */
+        bool outcome;
+    };
+
+    std::vector<SatCounter> shct;
+
+    Stats::Scalar distantFills;
+
+  public:
+    typedef SHiPRPParams Params;
+
+    SHiPRP(const Params *p);
+
+    void invalidate(CacheBlk *blk) override;
+    void touch(CacheBlk *blk, const PacketPtr pkt) override;
+    void reset(CacheBlk *blk, const PacketPtr pkt) override;
+    std::shared_ptr<ReplacementData> instantiateEntry() override;
+
+    void regStats() override;
+};
+
+#endif // __MEM_CACHE_REPLACEMENT_POLICIES_SHIP_RP_HH__
@@ -38,6 +38,8 @@
 from m5.params import *
 from m5.proxy import *
 from ClockedObject import ClockedObject
+from Compressors import BDI
+from ReplacementPolicies import LRURP
 
 class BaseTags(ClockedObject):
     type = 'BaseTags'
@@ -80,6 +82,23 @@ class RandomRepl(BaseSetAssoc):
     cxx_class = 'RandomRepl'
     cxx_header = "mem/cache/tags/random_repl.hh"
 
+class SetAssoc(BaseSetAssoc):
+    type = 'SetAssoc'
+    cxx_class = 'SetAssoc'
+    cxx_header = "mem/cache/tags/set_assoc.hh"
+    replacement_policy = Param.BaseReplacementPolicy(LRURP(),
+        "Replacement policy")
+
+class CompressedTags(SetAssoc):
+    type = 'CompressedTags'
+    cxx_class = 'CompressedTags'
+    cxx_header = "mem/cache/tags/compressed_tags.hh"
+    compressor = Param.BaseCacheCompressor(BDI(), "Compression model")
+    max_compression_ratio = Param.Unsigned(2, "Number of tags per way, "
+        "i.e. the most blocks a set holds per way when they compress")
+    segment_size = Param.Unsigned(8, "Allocation granularity of the "
+        "compressed data, in bytes")
+
 class FALRU(BaseTags):
     type = 'FALRU'
     cxx_class = 'FALRU'
@@ -49,7 +49,9 @@
 #ifndef __MEM_CACHE_TAGS_BASE_HH__
 #define __MEM_CACHE_TAGS_BASE_HH__
 
+#include <functional>
 #include <string>
+#include <vector>
 
 #include "base/callback.hh"
 #include "base/statistics.hh"
@@ -240,6 +242,16 @@ class BaseTags : public ClockedObject
 
     virtual CacheBlk* accessBlock(Addr addr, bool is_secure, Cycles &lat) = 0;
 
+    /**
+     * Access the block of a packet. Tags whose replacement learns from
+     * more than the address, e.g. the PC of the requester, override this;
+     * the default only looks at the address.
+     */
+    virtual CacheBlk* accessBlock(PacketPtr pkt, Cycles &lat)
+    {
+        return accessBlock(pkt->getAddr(), pkt->isSecure(), lat);
+    }
+
     virtual Addr extractTag(Addr addr) const = 0;
 
     virtual void insertBlock(PacketPtr pkt, CacheBlk *blk) = 0;
@@ -248,6 +260,28 @@ class BaseTags : public ClockedObject
 
     virtual CacheBlk* findVictim(Addr addr) = 0;
 
+    /**
+     * The data of a valid block changed in place. Tags that store blocks
+     * compressed recompute its size.
+     */
+    virtual void updateBlockData(CacheBlk *blk) {}
+
+    /**
+     * Tags that store blocks compressed can run out of room in a set
+     * when a block is filled or grows. Find the next block to evict for
+     * the set of a block to fit again. The caller has to evict it before
+     * asking for the next one.
+     * @param blk The block that stays.
+     * @param evictable Tells which of the other blocks may be evicted.
+     * @return The block to evict, nullptr if the set fits or nothing
+     * can be evicted.
+     */
+    virtual CacheBlk* findOverflowVictim(
+        CacheBlk *blk, const std::function<bool(CacheBlk*)> &evictable)
+    {
+        return nullptr;
+    }
+
     virtual int extractSet(Addr addr) const = 0;
 
     virtual void forEachBlk(CacheBlkVisitor &visitor) = 0;
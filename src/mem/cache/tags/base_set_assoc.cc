@@ -55,7 +55,13 @@
 using namespace std;
 
 BaseSetAssoc::BaseSetAssoc(const Params *p)
-    :BaseTags(p), assoc(p->assoc), allocAssoc(p->assoc),
+    : BaseSetAssoc(p, 1)
+{
+}
+
+BaseSetAssoc::BaseSetAssoc(const Params *p, unsigned tags_per_way)
+    :BaseTags(p), assoc(p->assoc * tags_per_way),
+     allocAssoc(p->assoc * tags_per_way),
      numSets(p->size / (p->block_size * p->assoc)),
      sequentialAccess(p->sequential_access)
 {
@@ -107,6 +113,7 @@ BaseSetAssoc::BaseSetAssoc(const Params *p)
             blk->set = i;
             blk->way = j;
         }
+        sets[i].initTags();
     }
 }
 
@@ -107,6 +107,13 @@ class BaseSetAssoc : public BaseTags
     /** Mask out all bits that aren't part of the set index. */
     unsigned setMask;
 
+    /**
+     * Construct a tag store with more tags per set than the cache has
+     * ways, for tag stores that fit more blocks in the same data array.
+     * @param tags_per_way The number of tags for each way.
+     */
+    BaseSetAssoc(const BaseSetAssocParams *p, unsigned tags_per_way);
+
 public:
 
     /** Convenience typedef. */
@@ -144,8 +151,12 @@ public:
         blk->srcMasterId = Request::invldMasterId;
         blk->task_id = ContextSwitchTaskId::Unknown;
         blk->tickInserted = curTick();
+        sets[blk->set].invalidateTag(blk);
     }
 
+    /** Keep the packet overload of the base visible. */
+    using BaseTags::accessBlock;
+
     /**
      * Access block and update replacement data. May not succeed, in which case
      * nullptr is returned. This has all the implications of a cache
@@ -267,6 +278,7 @@ public:
 
          // Set tag for new block.  Caller is responsible for setting status.
          blk->tag = extractTag(addr);
+         sets[blk->set].insertTag(blk, pkt->isSecure());
 
          // deal with what we are bringing in
          assert(master_id < cache->system->maxMasters());
@@ -48,7 +48,13 @@
 #ifndef __MEM_CACHE_TAGS_CACHESET_HH__
 #define __MEM_CACHE_TAGS_CACHESET_HH__
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "base/bitfield.hh"
+#include "base/types.hh"
 
 /**
  * An associative set of cache blocks.
@@ -63,6 +69,26 @@ class CacheSet
     /** Cache blocks in this set, maintained in LRU order 0 = MRU. */
     Blktype **blks;
 
+    /**
+     * Set up the way-indexed tag store. Must be called once blks holds
+     * the blocks of the set, with their tags and ways assigned.
+     */
+    void initTags();
+
+    /**
+     * Record a block filled with a new tag. The caller is expected to
+     * mark the block valid, and secure if is_secure is set.
+     * @param blk The block, with its new tag.
+     * @param is_secure True if the block is from the secure space.
+     */
+    void insertTag(Blktype *blk, bool is_secure);
+
+    /**
+     * Record that a block no longer holds valid data.
+     * @param blk The block to invalidate.
+     */
+    void invalidateTag(Blktype *blk);
+
     /**
      * Find a block matching the tag in this set.
      * @param way_id The id of the way that matches the tag.
@@ -85,8 +111,83 @@ class CacheSet
      */
     void moveToTail(Blktype *blk);
 
+  private:
+    /** Number of ways covered by one word of the masks. */
+    static const int waysPerWord = 64;
+
+    /** Ways compared at once, the compare loop bound is a multiple. */
+    static const int waysPerGroup = 8;
+
+    /**
+     * Ways compared in the last word: only as many as the set has,
+     * rounded up to whole groups, so small sets don't scan 64 tags.
+     */
+    int lastWordWays;
+
+    /**
+     * The tag store, indexed by way rather than by LRU position so that
+     * it does not move on replacement updates. The tags are packed so a
+     * lookup compares a whole word of ways in one loop the compiler can
+     * vectorize, instead of chasing a pointer to every block.
+     */
+    std::vector<Addr> tags;
+
+    /** Ways holding a valid block, one bit per way. */
+    std::vector<uint64_t> validMask;
+
+    /** Ways holding a block from the secure space. */
+    std::vector<uint64_t> secureMask;
+
+    /** The block in each way. */
+    std::vector<Blktype*> wayBlks;
 };
 
+template <class Blktype>
+void
+CacheSet<Blktype>::initTags()
+{
+    const int words = (assoc + waysPerWord - 1) / waysPerWord;
+    // round the tags up to whole groups so the compare loop needs no
+    // remainder handling; the padding ways are never valid
+    const int last_ways = assoc - (words - 1) * waysPerWord;
+    lastWordWays = (last_ways + waysPerGroup - 1) / waysPerGroup *
+        waysPerGroup;
+    tags.assign((words - 1) * waysPerWord + lastWordWays, 0);
+    validMask.assign(words, 0);
+    secureMask.assign(words, 0);
+    wayBlks.assign(assoc, nullptr);
+
+    for (int i = 0; i < assoc; ++i) {
+        Blktype *blk = blks[i];
+        assert(blk->way < assoc && !wayBlks[blk->way]);
+        wayBlks[blk->way] = blk;
+        tags[blk->way] = blk->tag;
+        if (blk->isValid())
+            insertTag(blk, blk->isSecure());
+    }
+}
+
+template <class Blktype>
+void
+CacheSet<Blktype>::insertTag(Blktype *blk, bool is_secure)
+{
+    const int word = blk->way / waysPerWord;
+    const uint64_t bit = 1ULL << (blk->way % waysPerWord);
+    tags[blk->way] = blk->tag;
+    validMask[word] |= bit;
+    if (is_secure)
+        secureMask[word] |= bit;
+    else
+        secureMask[word] &= ~bit;
+}
+
+template <class Blktype>
+void
+CacheSet<Blktype>::invalidateTag(Blktype *blk)
+{
+    validMask[blk->way / waysPerWord] &= ~(1ULL << (blk->way % waysPerWord));
+}
+
 template <class Blktype>
 Blktype*
 CacheSet<Blktype>::findBlk(Addr tag, bool is_secure, int& way_id) const
@@ -96,22 +197,35 @@ CacheSet<Blktype>::findBlk(Addr tag, bool is_secure, int& way_id) const
      * If no block is found way_id is set to assoc.
      */
     way_id = assoc;
-    for (int i = 0; i < assoc; ++i) {
-        if (blks[i]->tag == tag && blks[i]->isValid() &&
-            blks[i]->isSecure() == is_secure) {
-            way_id = i;
-            return blks[i];
-        }
-    }
-    return nullptr;
+    Blktype *blk = findBlk(tag, is_secure);
+    if (blk)
+        way_id = std::find(blks, blks + assoc, blk) - blks;
+    return blk;
 }
 
 template <class Blktype>
 Blktype*
 CacheSet<Blktype>::findBlk(Addr tag, bool is_secure) const
 {
-    int ignored_way_id;
-    return findBlk(tag, is_secure, ignored_way_id);
+    const size_t words = validMask.size();
+    for (size_t word = 0; word < words; ++word) {
+        const Addr *way_tags = &tags[word * waysPerWord];
+        const int ways = word + 1 == words ? lastWordWays : waysPerWord;
+        uint64_t hits = 0;
+        for (int i = 0; i < ways; ++i)
+            hits |= uint64_t(way_tags[i] == tag) << i;
+
+        hits &= validMask[word] &
+            (is_secure ? secureMask[word] : ~secureMask[word]);
+        if (hits) {
+            // a tag is only ever valid in one way per security space
+            Blktype *blk = wayBlks[word * waysPerWord + findLsbSet(hits)];
+            assert(blk->tag == tag && blk->isValid() &&
+                   blk->isSecure() == is_secure);
+            return blk;
+        }
+    }
+    return nullptr;
 }
 
 template <class Blktype>
@@ -0,0 +1,207 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of a set associative tag store holding compressed blocks.
+ */
+
+#include "mem/cache/tags/compressed_tags.hh"
+
+#include <algorithm>
+#include <cassert>
+
+#include "base/intmath.hh"
+#include "debug/CacheRepl.hh"
+#include "mem/cache/base.hh"
+
+CompressedTags::CompressedTags(const Params *p)
+    : SetAssoc(p, p->max_compression_ratio), compressor(p->compressor),
+      segmentSize(p->segment_size), setCapacity(p->assoc * p->block_size),
+      blkBytes(numBlocks, 0), setBytes(numSets, 0)
+{
+    fatal_if(p->max_compression_ratio == 0,
+             "%s: max_compression_ratio must be at least 1", name());
+    fatal_if(segmentSize == 0 || blkSize % segmentSize != 0,
+             "%s: segment_size must divide the block size", name());
+}
+
+void
+CompressedTags::allocate(const CacheBlk *blk, unsigned bytes)
+{
+    unsigned &blk_bytes = blkBytes[blk - blks];
+    setBytes[blk->set] = setBytes[blk->set] - blk_bytes + bytes;
+    residentBytes += bytes;
+    residentBytes -= blk_bytes;
+    blk_bytes = bytes;
+}
+
+unsigned
+CompressedTags::compress(const uint8_t *data)
+{
+    unsigned bytes = compressor->compressedSize(data, blkSize);
+    bytes = divCeil(std::max(bytes, 1u), segmentSize) * segmentSize;
+
+    compressions++;
+    uncompressedBytes += blkSize;
+    compressedBytes += bytes;
+    return bytes;
+}
+
+CacheBlk*
+CompressedTags::decompress(CacheBlk *blk, Cycles &lat)
+{
+    if (blk && blkBytes[blk - blks] < blkSize) {
+        lat += compressor->decompressionLatency;
+        decompressions++;
+    }
+    return blk;
+}
+
+CacheBlk*
+CompressedTags::accessBlock(Addr addr, bool is_secure, Cycles &lat)
+{
+    return decompress(SetAssoc::accessBlock(addr, is_secure, lat), lat);
+}
+
+CacheBlk*
+CompressedTags::accessBlock(PacketPtr pkt, Cycles &lat)
+{
+    return decompress(SetAssoc::accessBlock(pkt, lat), lat);
+}
+
+void
+CompressedTags::insertBlock(PacketPtr pkt, CacheBlk *blk)
+{
+    if (!blk->isValid())
+        residentBlocks++;
+    SetAssoc::insertBlock(pkt, blk);
+    // the data is written after the insertion, until then the block
+    // counts as uncompressed
+    allocate(blk, blkSize);
+}
+
+void
+CompressedTags::invalidate(CacheBlk *blk)
+{
+    SetAssoc::invalidate(blk);
+    allocate(blk, 0);
+    residentBlocks--;
+}
+
+void
+CompressedTags::updateBlockData(CacheBlk *blk)
+{
+    assert(blk->isValid());
+    allocate(blk, compress(blk->data));
+}
+
+CacheBlk*
+CompressedTags::findOverflowVictim(
+    CacheBlk *blk, const std::function<bool(CacheBlk*)> &evictable)
+{
+    const int set = blk->set;
+    if (setBytes[set] <= setCapacity)
+        return nullptr;
+
+    ReplacementCandidates candidates;
+    for (int i = 0; i < assoc; ++i) {
+        CacheBlk *other = sets[set].blks[i];
+        if (other != blk && other->isValid() && evictable(other))
+            candidates.push_back(other);
+    }
+    if (candidates.empty())
+        return nullptr;
+
+    // picking a victim updates the policy state, so only pick the
+    // blocks that do get evicted
+    CacheBlk *victim = replacementPolicy->getVictim(candidates);
+    overflowEvictions++;
+
+    DPRINTF(CacheRepl, "set %x: %d of %d bytes, evicting blk %x\n",
+            set, setBytes[set], setCapacity,
+            regenerateBlkAddr(victim->tag, set));
+    return victim;
+}
+
+void
+CompressedTags::regStats()
+{
+    SetAssoc::regStats();
+
+    compressions
+        .name(name() + ".compressions")
+        .desc("number of times block data was compressed");
+
+    uncompressedBytes
+        .name(name() + ".uncompressedBytes")
+        .desc("bytes of block data compressed");
+
+    compressedBytes
+        .name(name() + ".compressedBytes")
+        .desc("bytes the compressed block data took in the data array");
+
+    compressionRatio
+        .name(name() + ".compressionRatio")
+        .desc("average compression ratio of the valid blocks");
+    compressionRatio = effectiveCapacity / residentBytes;
+
+    decompressions
+        .name(name() + ".decompressions")
+        .desc("number of hits on compressed blocks");
+
+    overflowEvictions
+        .name(name() + ".overflowEvictions")
+        .desc("number of blocks evicted to make room for a fill or a "
+              "grown block");
+
+    residentBlocks
+        .name(name() + ".residentBlocks")
+        .desc("average number of valid blocks");
+
+    residentBytes
+        .name(name() + ".residentBytes")
+        .desc("average data array bytes taken by the valid blocks");
+
+    effectiveCapacity
+        .name(name() + ".effectiveCapacity")
+        .desc("average uncompressed bytes of the valid blocks");
+    effectiveCapacity = residentBlocks * Stats::constant(blkSize);
+
+    capacityGain
+        .name(name() + ".capacityGain")
+        .desc("effective capacity over the size of the data array");
+    capacityGain =
+        effectiveCapacity / Stats::constant(double(setCapacity) * numSets);
+}
+
+CompressedTags*
+CompressedTagsParams::create()
+{
+    return new CompressedTags(this);
+}
@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a set associative tag store holding compressed blocks.
+ */
+
+#ifndef __MEM_CACHE_TAGS_COMPRESSED_TAGS_HH__
+#define __MEM_CACHE_TAGS_COMPRESSED_TAGS_HH__
+
+#include <functional>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "mem/cache/compressors/base.hh"
+#include "mem/cache/tags/set_assoc.hh"
+#include "params/CompressedTags.hh"
+
+/**
+ * Set associative tags that store the blocks compressed, so that a set
+ * holds more blocks than the cache has ways when their data compresses.
+ * Each set has max_compression_ratio tags per way and a data array of
+ * its ways times the block size, allocated in segments; a block takes
+ * the segments of its size as given by the compressor.
+ *
+ * This models the capacity of superblock tags without their constraint
+ * that the blocks sharing a way be neighbours: any blocks of the set can
+ * share the data array. The data stays uncompressed functionally in
+ * every block, only its size is tracked.
+ *
+ * The size of a block is computed whenever the cache writes data into
+ * it. A fill or a block that grows can overflow the set, and the cache
+ * then evicts the blocks the replacement policy picks, one at a time,
+ * until the set fits again. Hits on compressed blocks pay the
+ * decompression latency.
+ */
+class CompressedTags : public SetAssoc
+{
+  protected:
+    BaseCacheCompressor *compressor;
+
+    /** Granularity of the data array allocation, in bytes */
+    const unsigned segmentSize;
+
+    /** Data array bytes of one set */
+    const unsigned setCapacity;
+
+    /** Allocated bytes of each block, indexed like blks */
+    std::vector<unsigned> blkBytes;
+
+    /** Allocated bytes of each set */
+    std::vector<unsigned> setBytes;
+
+    /** Change the allocated bytes of a block */
+    void allocate(const CacheBlk *blk, unsigned bytes);
+
+    /** Compressed size of a block of data, rounded up to segments */
+    unsigned compress(const uint8_t *data);
+
+    /** Add the decompression latency on a hit on a compressed block */
+    CacheBlk *decompress(CacheBlk *blk, Cycles &lat);
+
+    Stats::Scalar compressions;
+    Stats::Scalar uncompressedBytes;
+    Stats::Scalar compressedBytes;
+    Stats::Formula compressionRatio;
+    Stats::Scalar decompressions;
+    Stats::Scalar overflowEvictions;
+    Stats::Average residentBlocks;
+    Stats::Average residentBytes;
+    Stats::Formula effectiveCapacity;
+    Stats::Formula capacityGain;
+
+  public:
+    /** Convenience typedef. */
+    typedef CompressedTagsParams Params;
+
+    CompressedTags(const Params *p);
+
+    CacheBlk* accessBlock(Addr addr, bool is_secure, Cycles &lat) override;
+    CacheBlk* accessBlock(PacketPtr pkt, Cycles &lat) override;
+    void insertBlock(PacketPtr pkt, CacheBlk *blk) override;
+    void invalidate(CacheBlk *blk) override;
+    void updateBlockData(CacheBlk *blk) override;
+    CacheBlk* findOverflowVictim(
+        CacheBlk *blk,
+        const std::function<bool(CacheBlk*)> &evictable) override;
+
+    void regStats() override;
+};
+
+#endif // __MEM_CACHE_TAGS_COMPRESSED_TAGS_HH__
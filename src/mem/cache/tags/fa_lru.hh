@@ -194,6 +194,9 @@ public:
      */
     CacheBlk* accessBlock(Addr addr, bool is_secure, Cycles &lat) override;
 
+    /** Keep the packet overload of the base visible. */
+    using BaseTags::accessBlock;
+
     /**
      * Find the block in the cache, do not update the replacement data.
      * @param addr The address to look for.
@@ -69,6 +69,7 @@ class LRU : public BaseSetAssoc
      */
     ~LRU() {}
 
+    using BaseTags::accessBlock;
     CacheBlk* accessBlock(Addr addr, bool is_secure, Cycles &lat);
     CacheBlk* findVictim(Addr addr);
     void insertBlock(PacketPtr pkt, BlkType *blk);
@@ -58,6 +58,7 @@ class RandomRepl : public BaseSetAssoc
      */
     ~RandomRepl() {}
 
+    using BaseTags::accessBlock;
     CacheBlk* accessBlock(Addr addr, bool is_secure, Cycles &lat);
     CacheBlk* findVictim(Addr addr);
     void insertBlock(PacketPtr pkt, BlkType *blk);
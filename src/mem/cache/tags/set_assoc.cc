@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Definitions of a set associative tag store with a replacement policy
+ * object.
+ */
+
+#include "mem/cache/tags/set_assoc.hh"
+
+#include "debug/CacheRepl.hh"
+#include "mem/cache/base.hh"
+
+SetAssoc::SetAssoc(const Params *p)
+    : SetAssoc(p, 1)
+{
+}
+
+SetAssoc::SetAssoc(const Params *p, unsigned tags_per_way)
+    : BaseSetAssoc(p, tags_per_way), replacementPolicy(p->replacement_policy)
+{
+    replacementPolicy->setGeometry(numSets, assoc);
+    for (unsigned i = 0; i < numBlocks; ++i)
+        blks[i].replacementData = replacementPolicy->instantiateEntry();
+}
+
+CacheBlk*
+SetAssoc::accessBlock(Addr addr, bool is_secure, Cycles &lat)
+{
+    CacheBlk *blk = BaseSetAssoc::accessBlock(addr, is_secure, lat);
+    if (blk != nullptr)
+        replacementPolicy->touch(blk, nullptr);
+    return blk;
+}
+
+CacheBlk*
+SetAssoc::accessBlock(PacketPtr pkt, Cycles &lat)
+{
+    CacheBlk *blk =
+        BaseSetAssoc::accessBlock(pkt->getAddr(), pkt->isSecure(), lat);
+    if (blk != nullptr)
+        replacementPolicy->touch(blk, pkt);
+    return blk;
+}
+
+CacheBlk*
+SetAssoc::findVictim(Addr addr)
+{
+    int set = extractSet(addr);
+
+    ReplacementCandidates candidates;
+    candidates.reserve(allocAssoc);
+    // the blocks of a set stay in way order, only the LRU tags move them
+    for (unsigned way = 0; way < allocAssoc; ++way) {
+        CacheBlk *blk = sets[set].blks[way];
+        if (!blk->isValid())
+            return blk;
+        candidates.push_back(blk);
+    }
+
+    CacheBlk *blk = replacementPolicy->getVictim(candidates);
+    DPRINTF(CacheRepl, "set %x: selecting blk %x for replacement\n",
+            blk->set, regenerateBlkAddr(blk->tag, blk->set));
+    return blk;
+}
+
+void
+SetAssoc::insertBlock(PacketPtr pkt, CacheBlk *blk)
+{
+    if (blk->isValid())
+        replacementPolicy->invalidate(blk);
+    BaseSetAssoc::insertBlock(pkt, blk);
+    replacementPolicy->reset(blk, pkt);
+}
+
+void
+SetAssoc::invalidate(CacheBlk *blk)
+{
+    BaseSetAssoc::invalidate(blk);
+    replacementPolicy->invalidate(blk);
+}
+
+SetAssoc*
+SetAssocParams::create()
+{
+    return new SetAssoc(this);
+}
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Implementation of a bridge between two event queues.
+ */
+
+#include "mem/eventq_bridge.hh"
+
+#include <algorithm>
+
+#include "base/trace.hh"
+#include "debug/Drain.hh"
+#include "debug/EventQueueBridge.hh"
+#include "params/EventQueueBridge.hh"
+
+std::map<EventQueue *, std::vector<EventQueueBridge::Crossing *>>
+    EventQueueBridge::crossings;
+
+std::map<EventQueue *, EventQueueBridge::Poll> EventQueueBridge::polls;
+
+void
+EventQueueBridge::Crossing::post(PacketPtr pkt, Tick due, bool snoop_resp)
+{
+    {
+        std::lock_guard<std::mutex> lock(inboxLock);
+        inbox.push_back(InFlight{due, snoop_resp, pkt});
+    }
+
+    EventQueue *eq = dest;
+    bool local = !inParallelMode || eq == curEventQueue();
+
+    // the poll of the destination picks the packet up
+    if (!local && !bridge.deterministic)
+        return;
+
+    Event *handover = new EventFunctionWrapper([eq]{ deliverDue(eq); },
+                                               bridge.name() + ".handover",
+                                               true);
+    if (local) {
+        eq->schedule(handover, due);
+    } else {
+        // picked up by the destination at the next quantum barrier,
+        // which is no later than due as the delay covers a quantum
+        eq->schedule(handover, due, true);
+    }
+}
+
+void
+EventQueueBridge::Crossing::takeDue(std::vector<InFlight> &due)
+{
+    std::lock_guard<std::mutex> lock(inboxLock);
+
+    // the packet delays differ, so the due packets are not necessarily
+    // at the front
+    auto i = inbox.begin();
+    while (i != inbox.end()) {
+        if (i->due <= curTick()) {
+            due.push_back(*i);
+            i = inbox.erase(i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+bool
+EventQueueBridge::Crossing::checkFunctional(PacketPtr pkt)
+{
+    std::lock_guard<std::mutex> lock(inboxLock);
+
+    for (auto &in_flight : inbox) {
+        if (pkt->checkFunctional(in_flight.pkt)) {
+            pkt->makeResponse();
+            return true;
+        }
+    }
+    return false;
+}
+
+bool
+EventQueueBridge::Crossing::empty()
+{
+    std::lock_guard<std::mutex> lock(inboxLock);
+    return inbox.empty();
+}
+
+EventQueueBridge::BridgeSlavePort::BridgeSlavePort(
+        const std::string& _name, EventQueueBridge& _bridge,
+        BridgeMasterPort& _masterPort)
+    : SlavePort(_name, &_bridge), bridge(_bridge), masterPort(_masterPort)
+{
+}
+
+EventQueueBridge::BridgeMasterPort::BridgeMasterPort(
+        const std::string& _name, EventQueueBridge& _bridge,
+        BridgeSlavePort& _slavePort)
+    : MasterPort(_name, &_bridge), bridge(_bridge), slavePort(_slavePort)
+{
+}
+
+EventQueueBridge::EventQueueBridge(Params *p)
+    : MemObject(p),
+      slavePort(p->name + ".slave", *this, masterPort),
+      masterPort(p->name + ".master", *this, slavePort),
+      downward(*this), upward(*this),
+      delay(p->delay), deterministic(p->deterministic),
+      // creates the queue if no other object is on it
+      masterQueue(getEventQueue(p->master_eventq_index))
+{
+}
+
+BaseMasterPort&
+EventQueueBridge::getMasterPort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "master")
+        return masterPort;
+    else
+        // pass it along to our super class
+        return MemObject::getMasterPort(if_name, idx);
+}
+
+BaseSlavePort&
+EventQueueBridge::getSlavePort(const std::string &if_name, PortID idx)
+{
+    if (if_name == "slave")
+        return slavePort;
+    else
+        // pass it along to our super class
+        return MemObject::getSlavePort(if_name, idx);
+}
+
+void
+EventQueueBridge::init()
+{
+    if (!slavePort.isConnected() || !masterPort.isConnected())
+        fatal("Both ports of an event queue bridge must be connected.\n");
+
+    downward.dest = masterQueue;
+    upward.dest = eventQueue();
+
+    // init runs in the same order on every run, which fixes the order
+    // the crossings into a queue are drained in
+    crossings[downward.dest].push_back(&downward);
+    crossings[upward.dest].push_back(&upward);
+}
+
+void
+EventQueueBridge::startup()
+{
+    if (masterQueue == eventQueue())
+        return;
+
+    // the quantum is only known once the root object is set up
+    if (deterministic && simQuantum > delay)
+        fatal("%s: a deterministic event queue bridge needs a delay (%d) "
+              "of at least the simulation quantum (%d)\n", name(), delay,
+              simQuantum);
+
+    if (!deterministic) {
+        startPolling(downward.dest, delay);
+        startPolling(upward.dest, delay);
+    }
+}
+
+void
+EventQueueBridge::startPolling(EventQueue *eq, Tick period)
+{
+    auto i = polls.find(eq);
+    if (i != polls.end()) {
+        // poll as often as the shortest link into the queue needs
+        i->second.period = std::min(i->second.period, period);
+        return;
+    }
+
+    // startup runs before the queues run in parallel, so the poll can
+    // be scheduled on eq directly
+    Event *event = new EventFunctionWrapper([eq]{
+            deliverDue(eq);
+            const Poll &poll = polls.at(eq);
+            eq->schedule(poll.event, eq->getCurTick() + poll.period);
+        }, "EventQueueBridge.poll");
+    polls[eq] = Poll{event, period};
+    eq->schedule(event, eq->getCurTick() + period);
+}
+
+void
+EventQueueBridge::checkInPlace(EventQueue *target, const char *what,
+                               PacketPtr pkt) const
+{
+    fatal_if(inParallelMode && target != curEventQueue(),
+             "%s: %s for %s addr %#x cannot cross event queues while they "
+             "run in parallel; --parallel-eventqs needs cores that do not "
+             "share lines and timing CPUs\n", name(), what,
+             pkt->cmdString(), pkt->getAddr());
+}
+
+void
+EventQueueBridge::deliverDue(EventQueue *eq)
+{
+    for (auto crossing : crossings.at(eq))
+        crossing->bridge.deliver(*crossing);
+}
+
+void
+EventQueueBridge::deliver(Crossing &crossing)
+{
+    std::vector<Crossing::InFlight> due;
+    crossing.takeDue(due);
+
+    for (auto &in_flight : due) {
+        if (&crossing == &downward)
+            masterPort.deliver(in_flight.pkt, in_flight.snoopResp);
+        else
+            slavePort.deliver(in_flight.pkt);
+    }
+
+    checkDrained();
+}
+
+bool
+EventQueueBridge::BridgeSlavePort::recvTimingReq(PacketPtr pkt)
+{
+    DPRINTF(EventQueueBridge, "recvTimingReq: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    if (pkt->isExpressSnoop()) {
+        // express snoops are instantaneous and always succeed, and the
+        // sender still looks at the packet, so forward it in place
+        bridge.checkInPlace(bridge.masterQueue, "an express snoop", pkt);
+        bool M5_VAR_USED success = masterPort.sendTimingReq(pkt);
+        assert(success);
+        return true;
+    }
+
+    // the crossing pays for the delay the packet has accumulated
+    Tick receive_delay = pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    bridge.downward.post(pkt, curTick() + bridge.delay + receive_delay,
+                         false);
+    return true;
+}
+
+bool
+EventQueueBridge::BridgeSlavePort::recvTimingSnoopResp(PacketPtr pkt)
+{
+    DPRINTF(EventQueueBridge, "recvTimingSnoopResp: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    Tick receive_delay = pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    bridge.downward.post(pkt, curTick() + bridge.delay + receive_delay,
+                         true);
+    return true;
+}
+
+void
+EventQueueBridge::BridgeSlavePort::deliver(PacketPtr pkt)
+{
+    // keep the responses in order behind any that were refused
+    if (!pendingResps.empty() || !sendTimingResp(pkt)) {
+        DPRINTF(EventQueueBridge, "Response 0x%x waits for a retry\n",
+                pkt->getAddr());
+        pendingResps.push_back(pkt);
+    }
+}
+
+void
+EventQueueBridge::BridgeSlavePort::recvRespRetry()
+{
+    while (!pendingResps.empty() && sendTimingResp(pendingResps.front()))
+        pendingResps.pop_front();
+
+    bridge.checkDrained();
+}
+
+Tick
+EventQueueBridge::BridgeSlavePort::recvAtomic(PacketPtr pkt)
+{
+    bridge.checkInPlace(bridge.masterQueue, "an atomic access", pkt);
+    return bridge.delay + masterPort.sendAtomic(pkt);
+}
+
+void
+EventQueueBridge::BridgeSlavePort::recvFunctional(PacketPtr pkt)
+{
+    pkt->pushLabel(name());
+
+    // a response or request may be in flight in either direction
+    if (bridge.upward.checkFunctional(pkt) ||
+        bridge.downward.checkFunctional(pkt)) {
+        return;
+    }
+
+    pkt->popLabel();
+
+    // this would leave the core's queue from inside its caches, see the
+    // class description
+    bridge.checkInPlace(bridge.masterQueue, "a functional access", pkt);
+    masterPort.sendFunctional(pkt);
+}
+
+AddrRangeList
+EventQueueBridge::BridgeSlavePort::getAddrRanges() const
+{
+    // the bridge is transparent, the master side decides
+    return masterPort.getAddrRanges();
+}
+
+bool
+EventQueueBridge::BridgeMasterPort::recvTimingResp(PacketPtr pkt)
+{
+    DPRINTF(EventQueueBridge, "recvTimingResp: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    Tick receive_delay = pkt->headerDelay + pkt->payloadDelay;
+    pkt->headerDelay = pkt->payloadDelay = 0;
+
+    bridge.upward.post(pkt, curTick() + bridge.delay + receive_delay, false);
+    return true;
+}
+
+void
+EventQueueBridge::BridgeMasterPort::recvTimingSnoopReq(PacketPtr pkt)
+{
+    DPRINTF(EventQueueBridge, "recvTimingSnoopReq: %s addr 0x%x\n",
+            pkt->cmdString(), pkt->getAddr());
+
+    // the snooped caches answer on the packet itself, so the snoop
+    // cannot be deferred
+    bridge.checkInPlace(bridge.eventQueue(), "a snoop", pkt);
+    slavePort.sendTimingSnoopReq(pkt);
+}
+
+void
+EventQueueBridge::BridgeMasterPort::deliver(PacketPtr pkt, bool snoop_resp)
+{
+    if (snoop_resp) {
+        if (!pendingSnoopResps.empty() || !sendTimingSnoopResp(pkt))
+            pendingSnoopResps.push_back(pkt);
+    } else {
+        if (!pendingReqs.empty() || !sendTimingReq(pkt)) {
+            DPRINTF(EventQueueBridge, "Request 0x%x waits for a retry\n",
+                    pkt->getAddr());
+            pendingReqs.push_back(pkt);
+        }
+    }
+}
+
+void
+EventQueueBridge::BridgeMasterPort::recvReqRetry()
+{
+    while (!pendingReqs.empty() && sendTimingReq(pendingReqs.front()))
+        pendingReqs.pop_front();
+
+    bridge.checkDrained();
+}
+
+void
+EventQueueBridge::BridgeMasterPort::recvRetrySnoopResp()
+{
+    while (!pendingSnoopResps.empty() &&
+           sendTimingSnoopResp(pendingSnoopResps.front()))
+        pendingSnoopResps.pop_front();
+
+    bridge.checkDrained();
+}
+
+Tick
+EventQueueBridge::BridgeMasterPort::recvAtomicSnoop(PacketPtr pkt)
+{
+    bridge.checkInPlace(bridge.eventQueue(), "an atomic snoop", pkt);
+    return slavePort.sendAtomicSnoop(pkt);
+}
+
+void
+EventQueueBridge::BridgeMasterPort::recvFunctionalSnoop(PacketPtr pkt)
+{
+    // the thread of the slave side is either between events or waiting
+    // in a syscall or page-table walk, never inside its caches, see the
+    // class description
+    EventQueue::ScopedMigration migrate(bridge.eventQueue(), inParallelMode);
+    slavePort.sendFunctionalSnoop(pkt);
+}
+
+void
+EventQueueBridge::BridgeMasterPort::recvRangeChange()
+{
+    slavePort.sendRangeChange();
+}
+
+bool
+EventQueueBridge::BridgeMasterPort::isSnooping() const
+{
+    // snoop on behalf of whatever sits on the other side
+    return slavePort.isSnooping();
+}
+
+bool
+EventQueueBridge::idle()
+{
+    return downward.empty() && upward.empty() && slavePort.idle() &&
+        masterPort.idle();
+}
+
+void
+EventQueueBridge::checkDrained()
+{
+    if (drainState() == DrainState::Draining && idle()) {
+        DPRINTF(Drain, "Event queue bridge done draining\n");
+        signalDrainDone();
+    }
+}
+
+DrainState
+EventQueueBridge::drain()
+{
+    return idle() ? DrainState::Drained : DrainState::Draining;
+}
+
+EventQueueBridge *
+EventQueueBridgeParams::create()
+{
+    return new EventQueueBridge(this);
+}
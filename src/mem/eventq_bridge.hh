@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a bridge between a master and a slave that are
+ * simulated on different event queues, i.e. by different host threads.
+ */
+
+#ifndef __MEM_EVENTQ_BRIDGE_HH__
+#define __MEM_EVENTQ_BRIDGE_HH__
+
+#include <deque>
+#include <map>
+#include <mutex>
+#include <vector>
+
+#include "base/types.hh"
+#include "mem/mem_object.hh"
+#include "params/EventQueueBridge.hh"
+
+/**
+ * An event queue bridge connects a slave side simulated on the event
+ * queue of the bridge itself (typically a private cache of a core) to a
+ * master side simulated on master_eventq_index (typically the shared
+ * crossbar). Timing requests, responses and snoop responses cross with
+ * a fixed delay through a mutex-guarded inbox per direction and are
+ * handed over by the thread of the destination queue; a thread never
+ * runs the objects of another queue to deliver a packet.
+ *
+ * In deterministic mode the hand-over events are scheduled as global
+ * events, which the destination queue only picks up at the next quantum
+ * barrier. As long as the delay is at least one quantum every packet is
+ * known to its destination before it is due, and all the bridges
+ * delivering to a queue drain their inboxes in a fixed order, so the
+ * interleaving of the host threads does not change the simulated
+ * result. Otherwise the destination queue polls its inboxes every
+ * delay ticks and hands a packet over at the first poll at or after it
+ * is due, which allows delays shorter than the quantum at the cost of
+ * repeatability and of up to one more delay of latency.
+ *
+ * Snoop requests, express snoops and atomic accesses have to be
+ * answered in place, which would mean running the other side's caches
+ * (and behind them a core's LSQ) in the middle of an event of this
+ * side. While the queues run in parallel these are therefore fatal:
+ * cores on different queues must not share lines, and the CPUs must
+ * use timing accesses. The snoop filter of the crossbar only snoops a
+ * bridge for lines its side holds, so private data never causes one.
+ *
+ * Functional snoops are still forwarded by migrating to the slave side,
+ * as SE mode syscalls and page-table walks read and write memory
+ * through the system port on queue 0. This is safe because a core's
+ * thread only ever leaves its queue from the CPU (a syscall or a TLB
+ * miss in SE mode), never from inside its caches, so the caches a
+ * functional snoop visits are between accesses. Functional accesses
+ * from the slave side are fatal while the queues run in parallel.
+ *
+ * The inboxes are not bounded: a thread never waits for space on the
+ * other side, and a refused hand-over is retried when the receiver asks
+ * for it.
+ */
+class EventQueueBridge : public MemObject
+{
+  protected:
+
+    /**
+     * One direction through the bridge. The thread running the source
+     * side posts packets; they are taken out on the destination queue
+     * once they are due.
+     */
+    class Crossing
+    {
+      public:
+
+        /** A packet in flight along with the tick it is due */
+        struct InFlight
+        {
+            Tick due;
+            bool snoopResp;
+            PacketPtr pkt;
+        };
+
+        Crossing(EventQueueBridge &_bridge) : bridge(_bridge) {}
+
+        /** Queue a packet and schedule its hand-over on dest */
+        void post(PacketPtr pkt, Tick due, bool snoop_resp);
+
+        /** Take out all the packets due by now, in posting order */
+        void takeDue(std::vector<InFlight> &due);
+
+        /** Try to satisfy a functional access from the packets in flight */
+        bool checkFunctional(PacketPtr pkt);
+
+        bool empty();
+
+        EventQueueBridge &bridge;
+
+        /** The queue the packets are delivered on, set at init */
+        EventQueue *dest;
+
+      private:
+
+        std::mutex inboxLock;
+
+        std::deque<InFlight> inbox;
+    };
+
+    class BridgeMasterPort;
+
+    /**
+     * The port on the side of the bridge that connects to the master,
+     * on the event queue of the bridge.
+     */
+    class BridgeSlavePort : public SlavePort
+    {
+      public:
+
+        BridgeSlavePort(const std::string& _name, EventQueueBridge& _bridge,
+                        BridgeMasterPort& _masterPort);
+
+        /** Send a response that reached this side */
+        void deliver(PacketPtr pkt);
+
+        bool idle() const { return pendingResps.empty(); }
+
+      protected:
+
+        bool recvTimingReq(PacketPtr pkt) override;
+
+        bool tryTiming(PacketPtr pkt) override { return true; }
+
+        bool recvTimingSnoopResp(PacketPtr pkt) override;
+
+        void recvRespRetry() override;
+
+        Tick recvAtomic(PacketPtr pkt) override;
+
+        void recvFunctional(PacketPtr pkt) override;
+
+        AddrRangeList getAddrRanges() const override;
+
+      private:
+
+        EventQueueBridge& bridge;
+
+        BridgeMasterPort& masterPort;
+
+        /** Responses the master refused, waiting for a retry */
+        std::deque<PacketPtr> pendingResps;
+    };
+
+    /**
+     * The port on the side of the bridge that connects to the slave, on
+     * master_eventq_index.
+     */
+    class BridgeMasterPort : public MasterPort
+    {
+      public:
+
+        BridgeMasterPort(const std::string& _name, EventQueueBridge& _bridge,
+                         BridgeSlavePort& _slavePort);
+
+        /** Send a request or snoop response that reached this side */
+        void deliver(PacketPtr pkt, bool snoop_resp);
+
+        bool idle() const
+        { return pendingReqs.empty() && pendingSnoopResps.empty(); }
+
+      protected:
+
+        bool recvTimingResp(PacketPtr pkt) override;
+
+        void recvTimingSnoopReq(PacketPtr pkt) override;
+
+        void recvReqRetry() override;
+
+        void recvRetrySnoopResp() override;
+
+        Tick recvAtomicSnoop(PacketPtr pkt) override;
+
+        void recvFunctionalSnoop(PacketPtr pkt) override;
+
+        void recvRangeChange() override;
+
+        bool isSnooping() const override;
+
+      private:
+
+        EventQueueBridge& bridge;
+
+        BridgeSlavePort& slavePort;
+
+        /** Requests the slave refused, waiting for a retry */
+        std::deque<PacketPtr> pendingReqs;
+
+        /** Snoop responses the slave refused, waiting for a retry */
+        std::deque<PacketPtr> pendingSnoopResps;
+    };
+
+    BridgeSlavePort slavePort;
+
+    BridgeMasterPort masterPort;
+
+    /** Requests and snoop responses, from the slave to the master side */
+    Crossing downward;
+
+    /** Responses, from the master to the slave side */
+    Crossing upward;
+
+    /** Latency of a timing packet through the bridge */
+    const Tick delay;
+
+    const bool deterministic;
+
+    /** The event queue of the master side */
+    EventQueue *masterQueue;
+
+    /**
+     * The crossings delivering to each event queue, in the order they
+     * are drained. Filled at init, before any thread runs.
+     */
+    static std::map<EventQueue *, std::vector<Crossing *>> crossings;
+
+    /** Hand over all the packets due on one queue, crossing by crossing */
+    static void deliverDue(EventQueue *eq);
+
+    /** Hand over the due packets of one crossing */
+    void deliver(Crossing &crossing);
+
+    /** The poll of the non-deterministic crossings into a queue */
+    struct Poll
+    {
+        Event *event;
+        Tick period;
+    };
+
+    /** Polls per destination queue. Filled at startup. */
+    static std::map<EventQueue *, Poll> polls;
+
+    /** Poll the crossings into a queue every period ticks */
+    static void startPolling(EventQueue *eq, Tick period);
+
+    /**
+     * Fail if a packet that has to be answered in place would have to
+     * cross to another queue while the queues run in parallel.
+     */
+    void checkInPlace(EventQueue *target, const char *what,
+                      PacketPtr pkt) const;
+
+    bool idle();
+
+    void checkDrained();
+
+  public:
+
+    typedef EventQueueBridgeParams Params;
+
+    EventQueueBridge(Params *p);
+
+    BaseMasterPort& getMasterPort(const std::string& if_name,
+                                  PortID idx = InvalidPortID) override;
+    BaseSlavePort& getSlavePort(const std::string& if_name,
+                                PortID idx = InvalidPortID) override;
+
+    void init() override;
+
+    void startup() override;
+
+    DrainState drain() override;
+};
+
+#endif //__MEM_EVENTQ_BRIDGE_HH__
@@ -338,6 +338,10 @@ class Packet : public Printable
         ONLY_ACCESS_SPEC_BUFF      = 0x00080000,
 
         EXTERNAL_EVICTION = 0x00100000,
+
+        // [STT] The prefetcher left this access out of training, the
+        // load trains it once it commits
+        TRAIN_DEFERRED        = 0x00200000,
     };
 
     Flags flags;
@@ -593,6 +597,7 @@ class Packet : public Printable
     bool isSpecFlush() const         { return cmd.isSpecFlush(); }
     bool isL1Hit() const             { return flags.isSet(L1_HIT); }
     bool isExternalEviction() const  { return flags.isSet(EXTERNAL_EVICTION); }
+    bool isTrainDeferred() const     { return flags.isSet(TRAIN_DEFERRED); }
     // [SafeSpec] Check whether it is the first in split packets
     bool isFirst() const             { return flags.isSet(FIRST_IN_SPLIT); }
     bool onlyAccessSpecBuff() const
@@ -611,6 +616,8 @@ class Packet : public Printable
         flags.set(EXTERNAL_EVICTION);
     }
 
+    void setTrainDeferred()          { flags.set(TRAIN_DEFERRED); }
+
     void setOnlyAccessSpecBuff()
     {
         assert(isSpec());
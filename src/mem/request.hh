@@ -190,6 +190,11 @@ class Request
         /** The request cleans a memory location */
         CLEAN                       = 0x0000000200000000,
 
+        /** [STT] The load making the request may still be squashed */
+        SQUASHABLE                  = 0x0000000400000000,
+        /** [STT] The request is a doppelganger load to a predicted address */
+        DOPPELGANGER                = 0x0000000800000000,
+
         /** The request targets the point of unification */
         DST_POU                     = 0x0000001000000000,
 
@@ -788,6 +793,8 @@ class Request
     bool isInstFetch() const { return _flags.isSet(INST_FETCH); }
     bool isPrefetch() const { return _flags.isSet(PREFETCH); }
     bool isSpec() const { return _flags.isSet(SPEC); }
+    bool isSquashable() const { return _flags.isSet(SQUASHABLE); }
+    bool isDoppelganger() const { return _flags.isSet(DOPPELGANGER); }
     bool isLLSC() const { return _flags.isSet(LLSC); }
     bool isPriv() const { return _flags.isSet(PRIVILEGED); }
     bool isLockedRMW() const { return _flags.isSet(LOCKED_RMW); }
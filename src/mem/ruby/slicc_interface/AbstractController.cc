@@ -255,23 +255,20 @@ AbstractController::queueMemoryRead(const MachineID &id, Addr addr,
     // DPRINTFR(MemSpecBuffer, "%10s MemRead (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), coreId, type, sbeId, printAddress(addr));
     // if idx == -1, it is a write request which cannot be spec or expose.
     assert(!(type != 0 && sbeId == -1));
-    assert(sbeId >= -1 && sbeId <= 65);
-    assert(coreId < 8);
     assert(type >=0 && type <= 2);
     if (type == 0) {
-        for (int c = 0; c < 8; ++c) {
-            for (int i = 0; i < 66; ++i) {
-                if (m_specBuf[c][i].address == addr) {
-                    DPRINTFR(MemSpecBuffer, "%10s Cleared by Read (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), c, type, i, printAddress(addr));
-                    m_specBuf[c][i].address = 0;
-                    m_specBuf[c][i].data.clear();
-                }
-            }
-        }
+        clearSpecBuf(addr, type, "Read");
     } else if (type == 1) {
 
     } else if (type == 2) {
-        if (m_specBuf[coreId][sbeId].address == addr) {
+        auto line = m_specBuf.find(addr);
+        const DataBlock *spec_data = NULL;
+        if (line != m_specBuf.end()) {
+            auto entry = line->second.find(SBEId(coreId, sbeId));
+            if (entry != line->second.end())
+                spec_data = &entry->second;
+        }
+        if (spec_data) {
             DPRINTFR(MemSpecBuffer, "%10s Expose Hit (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), coreId, type, sbeId, printAddress(addr));
             ++m_expose_hits;
             assert(getMemoryQueue());
@@ -281,30 +278,14 @@ AbstractController::queueMemoryRead(const MachineID &id, Addr addr,
             (*msg).m_OriginalRequestorMachId = id;
             (*msg).m_Type = MemoryRequestType_MEMORY_READ;
             (*msg).m_MessageSize = MessageSizeType_Response_Data;
-            (*msg).m_DataBlk = m_specBuf[coreId][sbeId].data;
+            (*msg).m_DataBlk = *spec_data;
             getMemoryQueue()->enqueue(msg, clockEdge(), cyclesToTicks(Cycles(1)));
-            for (int c = 0; c < 8; ++c) {
-                for (int i = 0; i < 66; ++i) {
-                    if (m_specBuf[c][i].address == addr) {
-                        DPRINTFR(MemSpecBuffer, "%10s Cleared by Expose Hit (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), c, type, i, printAddress(addr));
-                        m_specBuf[c][i].address = 0;
-                        m_specBuf[c][i].data.clear();
-                    }
-                }
-            }
+            clearSpecBuf(addr, type, "Expose Hit");
             return;
         } else {
             DPRINTFR(MemSpecBuffer, "%10s Expose Miss (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), coreId, type, sbeId, printAddress(addr));
             ++m_expose_misses;
-            for (int c = 0; c < 8; ++c) {
-                for (int i = 0; i < 66; ++i) {
-                    if (m_specBuf[c][i].address == addr) {
-                        DPRINTFR(MemSpecBuffer, "%10s Cleared by Expose Miss (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), c, type, i, printAddress(addr));
-                        m_specBuf[c][i].address = 0;
-                        m_specBuf[c][i].data.clear();
-                    }
-                }
-            }
+            clearSpecBuf(addr, type, "Expose Miss");
         }
     }
     
@@ -331,6 +312,21 @@ AbstractController::queueMemoryRead(const MachineID &id, Addr addr,
     memoryPort.schedTimingReq(pkt, clockEdge(latency));
 }
 
+void
+AbstractController::clearSpecBuf(Addr addr, int type, const char *reason)
+{
+    auto line = m_specBuf.find(addr);
+    if (line == m_specBuf.end())
+        return;
+
+    for (auto &entry : line->second) {
+        const SBEId &sbe = entry.first;
+        DPRINTFR(MemSpecBuffer, "%10s Cleared by %s (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), reason, sbe.first, type, sbe.second, printAddress(addr));
+        m_specBufLines.erase(sbe);
+    }
+    m_specBuf.erase(line);
+}
+
 void
 AbstractController::queueMemoryWrite(const MachineID &id, Addr addr,
                                      Cycles latency, const DataBlock &block)
@@ -424,9 +420,18 @@ AbstractController::recvTimingResp(PacketPtr pkt)
                                  RubySystem::getBlockSizeBytes());
         if (type == 1) {
             DPRINTFR(MemSpecBuffer, "%10s Updated by ReadSpec (core=%d, type=%d, idx=%d, addr=%#x)\n", curTick(), coreId, type, sbeId, printAddress(pkt->getAddr()));
-            m_specBuf[coreId][sbeId].address = pkt->getAddr();
-            m_specBuf[coreId][sbeId].data.setData(pkt->getPtr<uint8_t>(), 0,
-                                                  RubySystem::getBlockSizeBytes());
+            SBEId sbe(coreId, sbeId);
+            // the entry forgets the line it held before
+            auto old = m_specBufLines.find(sbe);
+            if (old != m_specBufLines.end()) {
+                auto line = m_specBuf.find(old->second);
+                line->second.erase(sbe);
+                if (line->second.empty())
+                    m_specBuf.erase(line);
+            }
+            m_specBufLines[sbe] = pkt->getAddr();
+            m_specBuf[pkt->getAddr()][sbe].setData(pkt->getPtr<uint8_t>(), 0,
+                                                   RubySystem::getBlockSizeBytes());
         }
     } else if (pkt->isWrite()) {
         (*msg).m_Type = MemoryRequestType_MEMORY_WB;
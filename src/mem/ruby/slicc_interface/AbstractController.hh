@@ -43,7 +43,10 @@
 
 #include <exception>
 #include <iostream>
+#include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
 #include "base/addr_range.hh"
 #include "base/callback.hh"
@@ -264,13 +267,17 @@ class AbstractController : public MemObject, public Consumer
     /** The address range to which the controller responds on the CPU side. */
     const AddrRangeList addrRanges;
 
-    struct SBE
-    {
-      Addr address;
-      DataBlock data;
-    };
+    // [SafeSpec] A spec buffer entry: (core, LQ slot) of the spec read
+    typedef std::pair<int, int> SBEId;
+
+    // Lines read speculatively, with the entries holding each of them, so
+    // that reads and exposes find the entries of a line without a scan
+    std::unordered_map<Addr, std::map<SBEId, DataBlock>> m_specBuf;
+    // The line each entry holds
+    std::map<SBEId, Addr> m_specBufLines;
 
-    SBE m_specBuf[8][66];
+    // Drop every entry holding addr
+    void clearSpecBuf(Addr addr, int type, const char *reason);
 };
 
 #endif // __MEM_RUBY_SLICC_INTERFACE_ABSTRACTCONTROLLER_HH__
@@ -28,6 +28,8 @@
 
 #include "mem/ruby/system/Sequencer.hh"
 
+#include <algorithm>
+
 #include "arch/x86/ldstflags.hh"
 #include "base/logging.hh"
 #include "base/str.hh"
@@ -57,10 +59,11 @@ RubySequencerParams::create()
 Sequencer::Sequencer(const Params *p)
     : RubyPort(p), m_IncompleteTimes(MachineType_NUM),
       deadlockCheckEvent([this]{ wakeup(); }, "Sequencer deadlock check"),
-      m_specBuf(33),
+      m_specBuf(p->spec_buffer_size),
       specBufferHitEvent([this]{ specBufferHitCallback(); }, "Sequencer spec buffer hit")
 {
     m_outstanding_count = 0;
+    m_specBufValid = 0;
 
     m_instCache_ptr = p->icache;
     m_dataCache_ptr = p->dcache;
@@ -430,13 +433,71 @@ Sequencer::writeCallback(Addr address, DataBlock& data,
                 initialRequestTime, forwardRequestTime, firstResponseTime);
 }
 
+int
+Sequencer::sbbSlot(PacketPtr pkt) const
+{
+    int idx = pkt->reqIdx;
+    fatal_if(idx < 0 || idx >= (int)m_specBuf.size(),
+             "LQ index %d does not fit a spec buffer of %d entries, "
+             "increase spec_buffer_size\n", idx, m_specBuf.size());
+    return idx * 2 + (pkt->isFirst() ? 0 : 1);
+}
+
+SBB&
+Sequencer::getSBB(PacketPtr pkt)
+{
+    return slotSBB(sbbSlot(pkt));
+}
+
+void
+Sequencer::fillSBB(PacketPtr pkt, SBB& sbb, const DataBlock& data)
+{
+    sbb.data = data;
+    if (!sbb.valid) {
+        sbb.valid = true;
+        m_specBufValid++;
+        m_specBufOccupancy = m_specBufValid;
+        m_specBufLines[makeLineAddress(sbb.reqAddress)].push_back(
+            sbbSlot(pkt));
+    }
+}
+
+void
+Sequencer::releaseSBB(int slot)
+{
+    SBB& sbb = slotSBB(slot);
+    if (!sbb.valid)
+        return;
+
+    sbb.valid = false;
+    m_specBufValid--;
+    m_specBufOccupancy = m_specBufValid;
+
+    // A valid block keeps its line until released, so the slot is in
+    // the holders of that line
+    Addr line = makeLineAddress(sbb.reqAddress);
+    auto it = m_specBufLines.find(line);
+    assert(it != m_specBufLines.end());
+    std::vector<int>& holders = it->second;
+    auto pos = std::find(holders.begin(), holders.end(), slot);
+    assert(pos != holders.end());
+    *pos = holders.back();
+    holders.pop_back();
+    if (holders.empty())
+        m_specBufLines.erase(it);
+}
+
+double
+Sequencer::specBufHitRate() const
+{
+    double lookups = m_specBufHits.value() + m_specBufMisses.value();
+    return lookups > 0 ? m_specBufHits.value() / lookups : 0;
+}
+
 bool Sequencer::updateSBB(PacketPtr pkt, DataBlock& data, Addr dataAddress) {
-    uint8_t idx = pkt->reqIdx;
-    SBE& sbe = m_specBuf[idx];
-    int blkIdx = pkt->isFirst() ? 0 : 1;
-    SBB& sbb = sbe.blocks[blkIdx];
+    SBB& sbb = getSBB(pkt);
     if (makeLineAddress(sbb.reqAddress) == dataAddress) {
-        sbb.data = data;
+        fillSBB(pkt, sbb, data);
         return true;
     }
     return false;
@@ -467,7 +528,8 @@ Sequencer::readCallback(Addr address, DataBlock& data,
 
     PacketPtr pkt = request->pkt;
     if (pkt->isSpec()) {
-        assert(!pkt->onlyAccessSpecBuff());
+        // onlyAccessSpecBuff() loads get here if their line had left
+        // the spec buffer
         DPRINTFR(SpecBuffer, "%10s SPEC_LD callback (idx=%d-%d, addr=%#x)\n", curTick(), pkt->reqIdx, pkt->isFirst()? 0 : 1, printAddress(pkt->getAddr()));
         updateSBB(pkt, data, address);
         if (!externalHit) {
@@ -475,12 +537,11 @@ Sequencer::readCallback(Addr address, DataBlock& data,
         }
     } else if (pkt->isExpose()) {
         DPRINTFR(SpecBuffer, "%10s EXPOSE callback (idx=%d-%d, addr=%#x)\n", curTick(), pkt->reqIdx, pkt->isFirst()? 0 : 1, printAddress(pkt->getAddr()));
+        // the load is no longer speculative
+        releaseSBB(sbbSlot(pkt));
     } else if (pkt->isValidate()) {
         DPRINTFR(SpecBuffer, "%10s VALIDATE callback (idx=%d-%d, addr=%#x)\n", curTick(), pkt->reqIdx, pkt->isFirst()? 0 : 1, printAddress(pkt->getAddr()));
-        uint8_t idx = pkt->reqIdx;
-        SBE& sbe = m_specBuf[idx];
-        int blkIdx = pkt->isFirst() ? 0 : 1;
-        SBB& sbb = sbe.blocks[blkIdx];
+        SBB& sbb = getSBB(pkt);
         assert(makeLineAddress(sbb.reqAddress) == address);
         if (!memcmp(sbb.data.getData(getOffset(pkt->getAddr()), pkt->getSize()), data.getData(getOffset(pkt->getAddr()), pkt->getSize()), pkt->getSize())) {
             *(pkt->getPtr<uint8_t>()) = 1;
@@ -493,6 +554,7 @@ Sequencer::readCallback(Addr address, DataBlock& data,
             // DPRINTFR(SpecBufferValidate, "%s\n", os.str());
             *(pkt->getPtr<uint8_t>()) = 0;
         }
+        releaseSBB(sbbSlot(pkt));
     }
 
     for (auto& dependentPkt : request->dependentSpecRequests) {
@@ -647,44 +709,42 @@ Sequencer::makeRequest(PacketPtr pkt)
     if (pkt->isSpec()) {
         assert(pkt->cmd == MemCmd::ReadSpecReq);
         assert(pkt->isSplit || pkt->isFirst());
-        uint8_t idx = pkt->reqIdx;
-        SBE& sbe = m_specBuf[idx];
-        sbe.isSplit = pkt->isSplit;
-        int blkIdx = pkt->isFirst() ? 0 : 1;
-        SBB& sbb = sbe.blocks[blkIdx];
+        SBB& sbb = getSBB(pkt);
+        m_specBuf[pkt->reqIdx].isSplit = pkt->isSplit;
+        // the LQ entry was reused, its old line is gone
+        releaseSBB(sbbSlot(pkt));
         sbb.reqAddress = pkt->getAddr();
         sbb.reqSize = pkt->getSize();
-        if (pkt->onlyAccessSpecBuff()) {
-            int srcIdx = pkt->srcIdx;
-            SBE& srcEntry = m_specBuf[srcIdx];
-            if (makeLineAddress(sbb.reqAddress) == makeLineAddress(srcEntry.blocks[0].reqAddress)) {
-                sbb.data = srcEntry.blocks[0].data;
-            } else if (makeLineAddress(sbb.reqAddress) == makeLineAddress(srcEntry.blocks[1].reqAddress)) {
-                sbb.data = srcEntry.blocks[1].data;
-            } else {
-                fatal("Requested address %#x is not present in the spec buffer\n", printAddress(sbb.reqAddress));
-            }
+
+        // Any valid block of the same line can serve the load, found by
+        // address rather than through the LQ index the CPU suggests
+        auto src = pkt->onlyAccessSpecBuff() ?
+            m_specBufLines.find(makeLineAddress(sbb.reqAddress)) :
+            m_specBufLines.end();
+        if (src != m_specBufLines.end()) {
+            int srcSlot = src->second.back();
+            const SBB& srcBlock = slotSBB(srcSlot);
+            fillSBB(pkt, sbb, srcBlock.data);
             memcpy(pkt->getPtr<uint8_t>(),
                    sbb.data.getData(getOffset(sbb.reqAddress), sbb.reqSize),
                    sbb.reqSize);
             m_specRequestQueue.push({pkt, curTick()});
-            DPRINTFR(SpecBuffer, "%10s SB Hit (idx=%d, addr=%#x) on (srcIdx=%d)\n", curTick(), idx, printAddress(sbb.reqAddress), srcIdx);
+            m_specBufHits++;
+            DPRINTFR(SpecBuffer, "%10s SB Hit (idx=%d, addr=%#x) on (srcIdx=%d)\n", curTick(), pkt->reqIdx, printAddress(sbb.reqAddress), srcSlot / 2);
             if (!specBufferHitEvent.scheduled()) {
                 schedule(specBufferHitEvent, clockEdge(Cycles(1)));
             }
             return RequestStatus_Issued;
         } else {
-            // assert it is not in the buffer
+            // not in the buffer (any more), fetch it from the caches
+            m_specBufMisses++;
             primary_type = secondary_type = RubyRequestType_SPEC_LD;
         }
     } else if (pkt->isExpose() || pkt->isValidate()) {
         assert(pkt->cmd == MemCmd::ExposeReq || pkt->cmd == MemCmd::ValidateReq);
         assert(pkt->isSplit || pkt->isFirst());
-        uint8_t idx = pkt->reqIdx;
-        SBE& sbe = m_specBuf[idx];
-        sbe.isSplit = pkt->isSplit;
-        int blkIdx = pkt->isFirst() ? 0 : 1;
-        SBB& sbb = sbe.blocks[blkIdx];
+        SBB& sbb = getSBB(pkt);
+        m_specBuf[pkt->reqIdx].isSplit = pkt->isSplit;
         if (sbb.reqAddress != pkt->getAddr()) {
             fatal("sbb.reqAddress != pkt->getAddr: %#x != %#x\n", printAddress(sbb.reqAddress), printAddress(pkt->getAddr()));
         }
@@ -906,6 +966,24 @@ Sequencer::regStats()
         .desc("Number of times a load aliased with a pending store")
         .flags(Stats::nozero);
 
+    m_specBufHits
+        .name(name() + ".spec_buffer_hits")
+        .desc("Number of spec loads served from the spec buffer")
+        .flags(Stats::nozero);
+    m_specBufMisses
+        .name(name() + ".spec_buffer_misses")
+        .desc("Number of spec loads sent to the caches")
+        .flags(Stats::nozero);
+    m_specBufHitRate
+        .method(this, &Sequencer::specBufHitRate)
+        .name(name() + ".spec_buffer_hit_rate")
+        .desc("Fraction of spec loads served from the spec buffer")
+        .flags(Stats::nozero);
+    m_specBufOccupancy
+        .name(name() + ".spec_buffer_occupancy")
+        .desc("Average number of spec buffer blocks holding data")
+        .flags(Stats::nozero);
+
     // These statistical variables are not for display.
     // The profiler will collate these across different
     // sequencers and display those collated statistics.
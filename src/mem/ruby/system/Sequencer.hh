@@ -60,6 +60,8 @@ struct SBB // SpecBufferBlock
 {
   Addr reqAddress;
   unsigned reqSize;
+  // data holds the line of reqAddress
+  bool valid;
   DataBlock data;
 };
 
@@ -260,6 +262,34 @@ class Sequencer : public RubyPort
     std::vector<SBE> m_specBuf;
     std::queue<std::pair<PacketPtr, Tick>> m_specRequestQueue;
     EventFunctionWrapper specBufferHitEvent;
+
+  private:
+    // [SafeSpec] The block of the spec buffer a packet uses
+    SBB& getSBB(PacketPtr pkt);
+    // Slot of the block of a packet, as kept in m_specBufLines, two per
+    // entry
+    int sbbSlot(PacketPtr pkt) const;
+    SBB& slotSBB(int slot)
+    { return m_specBuf[slot / 2].blocks[slot % 2]; }
+    // Mark a block as holding the line of its request
+    void fillSBB(PacketPtr pkt, SBB& sbb, const DataBlock& data);
+    // Drop the data of the block of a slot, e.g. before reusing it
+    void releaseSBB(int slot);
+    // Spec buffer hit rate, 0 until a spec load was seen
+    double specBufHitRate() const;
+
+    //! Slots of the valid spec buffer blocks of each line, so spec
+    //! buffer hits do not depend on the LQ index of the load that
+    //! fetched the line and releasing a block needs no scan
+    std::unordered_map<Addr, std::vector<int>> m_specBufLines;
+    unsigned m_specBufValid;
+
+    //! Spec loads served from the spec buffer and from the caches
+    Stats::Scalar m_specBufHits;
+    Stats::Scalar m_specBufMisses;
+    Stats::Value m_specBufHitRate;
+    //! Spec buffer blocks holding data
+    Stats::Average m_specBufOccupancy;
 };
 
 inline std::ostream&
@@ -77,6 +77,9 @@ class RubySequencer(RubyPort):
    # id used by protocols that support multiple sequencers per controller
    # 99 is the dummy default value
    coreid = Param.Int(99, "CorePair core id")
+   # [SafeSpec] spec loads are buffered by load queue index
+   spec_buffer_size = Param.Unsigned(33,
+       "Speculative buffer entries, at least the load queue size plus one")
 
 class DMASequencer(RubyPort):
    type = 'DMASequencer'
@@ -115,11 +115,28 @@ def _textFactory(fn, desc=True):
 
     return _m5.stats.initText(fn, desc)
 
+@_url_factory
+def _binFactory(fn, desc=False):
+    """Output stats in binary format.
+
+    Binary stat files hold one column per stat value and one row of
+    64-bit floats per dump, behind a schema that names the columns. They
+    are read with sample_scripts/stats_bin.py. Descriptions are left out
+    of the schema by default, but can be enabled by setting the desc
+    parameter to True.
+
+    Example: bin://stats.bin?desc=True
+
+    """
+
+    return _m5.stats.initBinary(fn, desc)
+
 factories = {
     # Default to the text factory if we're given a naked path
     "" : _textFactory,
     "file" : _textFactory,
     "text" : _textFactory,
+    "bin" : _binFactory,
 }
 
 def addStatVisitor(url):
@@ -32,6 +32,7 @@
  *          Steve Raasch
  */
 
+#include <algorithm>
 #include <cassert>
 #include <iostream>
 #include <string>
@@ -114,6 +115,8 @@ Event::insertBefore(Event *event, Event *curr)
     return event;
 }
 
+#if !USE_CALENDAR_EVENTQ
+
 void
 EventQueue::insert(Event *event)
 {
@@ -137,6 +140,8 @@ EventQueue::insert(Event *event)
     prev->nextBin = Event::insertBefore(event, curr);
 }
 
+#endif
+
 Event *
 Event::removeItem(Event *event, Event *top)
 {
@@ -168,6 +173,8 @@ Event::removeItem(Event *event, Event *top)
     return top;
 }
 
+#if !USE_CALENDAR_EVENTQ
+
 void
 EventQueue::remove(Event *event)
 {
@@ -200,6 +207,191 @@ EventQueue::remove(Event *event)
     prev->nextBin = Event::removeItem(event, curr);
 }
 
+#else
+
+// The calendar never gets smaller than this
+static const size_t minCalendarBuckets = 16;
+// Bucket width until the first resize measures one (1ns with 1ps ticks)
+static const Tick initialBucketWidth = 1000;
+
+static bool
+binBefore(const Event *a, const Event *b)
+{
+    return *a < *b;
+}
+
+void
+EventQueue::insert(Event *event)
+{
+    // Find the bin in the event's bucket, or where a new bin goes
+    size_t bucket = bucketOf(event->when());
+    Event *prev = NULL;
+    Event *curr = buckets[bucket];
+    while (curr && *curr < *event) {
+        prev = curr;
+        curr = curr->nextBin;
+    }
+
+    bool new_bin = !curr || *event < *curr;
+    Event *top = Event::insertBefore(event, curr);
+    if (prev)
+        prev->nextBin = top;
+    else
+        buckets[bucket] = top;
+
+    // Same rule as the list: the event goes on top of an equal bin
+    if (!head || *event <= *head)
+        head = event;
+
+    if (new_bin && ++numBins > 2 * buckets.size())
+        resizeCalendar(2 * buckets.size());
+}
+
+void
+EventQueue::remove(Event *event)
+{
+    if (head == NULL)
+        panic("event not found!");
+
+    assert(event->queue == this);
+
+    size_t bucket = bucketOf(event->when());
+    Event *prev = NULL;
+    Event *curr = buckets[bucket];
+    while (curr && *curr < *event) {
+        prev = curr;
+        curr = curr->nextBin;
+    }
+
+    if (!curr || *curr != *event)
+        panic("event not found!");
+
+    bool bin_gone = event == curr && !curr->nextInBin;
+    Event *top = Event::removeItem(event, curr);
+    if (prev)
+        prev->nextBin = top;
+    else
+        buckets[bucket] = top;
+
+    if (!bin_gone) {
+        if (head == curr)
+            head = top;
+        return;
+    }
+
+    // The earliest bin can only have been the first of its bucket
+    if (head == curr)
+        head = findHead(event->when());
+    removedBin();
+}
+
+Event *
+EventQueue::findHead(Tick from) const
+{
+    // Look at one window per bucket, starting from the window of from;
+    // the first bin of a bucket is in the window when it is the earliest
+    Tick window = from / bucketWidth;
+    size_t bucket = window % buckets.size();
+    for (size_t i = 0; i < buckets.size(); ++i) {
+        Event *first = buckets[bucket];
+        if (first && first->when() / bucketWidth <= window)
+            return first;
+
+        bucket = (bucket + 1) % buckets.size();
+        ++window;
+    }
+
+    // Nothing within a whole year, compare the buckets directly
+    Event *earliest = NULL;
+    for (Event *first : buckets) {
+        if (first && (!earliest || *first < *earliest))
+            earliest = first;
+    }
+    return earliest;
+}
+
+void
+EventQueue::insertBin(Event *bin)
+{
+    size_t bucket = bucketOf(bin->when());
+    Event *prev = NULL;
+    Event *curr = buckets[bucket];
+    while (curr && *curr < *bin) {
+        prev = curr;
+        curr = curr->nextBin;
+    }
+    assert(!curr || *bin < *curr);
+
+    bin->nextBin = curr;
+    if (prev)
+        prev->nextBin = bin;
+    else
+        buckets[bucket] = bin;
+}
+
+void
+EventQueue::removedBin()
+{
+    --numBins;
+    if (buckets.size() > minCalendarBuckets && numBins < buckets.size() / 2)
+        resizeCalendar(buckets.size() / 2);
+}
+
+void
+EventQueue::resizeCalendar(size_t num_buckets)
+{
+    std::vector<Event *> all = bins();
+
+    // Pick the width from the spacing of the earliest bins, as in
+    // Brown's calendar queue: three times their average gap, leaving out
+    // gaps more than twice the average
+    size_t sample = std::min(all.size(), (size_t)25);
+    std::partial_sort(all.begin(), all.begin() + sample, all.end(),
+                      binBefore);
+    if (sample > 1) {
+        double avg = double(all[sample - 1]->when() - all[0]->when()) /
+            (sample - 1);
+        double sum = 0;
+        unsigned count = 0;
+        for (size_t i = 1; i < sample; ++i) {
+            Tick gap = all[i]->when() - all[i - 1]->when();
+            if (gap <= 2 * avg) {
+                sum += gap;
+                ++count;
+            }
+        }
+        double width = count ? 3 * sum / count : 0;
+        if (width >= 1)
+            bucketWidth = width < MaxTick ? Tick(width) : MaxTick;
+    }
+
+    buckets.assign(num_buckets, NULL);
+    for (Event *bin : all)
+        insertBin(bin);
+}
+
+std::vector<Event *>
+EventQueue::bins() const
+{
+    std::vector<Event *> all;
+    all.reserve(numBins);
+    for (Event *bin : buckets) {
+        for (; bin; bin = bin->nextBin)
+            all.push_back(bin);
+    }
+    return all;
+}
+
+std::vector<Event *>
+EventQueue::sortedBins() const
+{
+    std::vector<Event *> all = bins();
+    std::sort(all.begin(), all.end(), binBefore);
+    return all;
+}
+
+#endif
+
 Event *
 EventQueue::serviceOne()
 {
@@ -208,6 +400,21 @@ EventQueue::serviceOne()
     Event *next = head->nextInBin;
     event->flags.clear(Event::Scheduled);
 
+#if USE_CALENDAR_EVENTQ
+    // The head bin is the first of its bucket
+    size_t bucket = bucketOf(event->when());
+    assert(buckets[bucket] == event);
+
+    if (next) {
+        next->nextBin = head->nextBin;
+        buckets[bucket] = next;
+        head = next;
+    } else {
+        buckets[bucket] = head->nextBin;
+        head = findHead(event->when());
+        removedBin();
+    }
+#else
     if (next) {
         // update the next bin pointer since it could be stale
         next->nextBin = head->nextBin;
@@ -219,6 +426,7 @@ EventQueue::serviceOne()
         // the 'in bin' list and point to the next bin list
         head = head->nextBin;
     }
+#endif
 
     // handle action
     if (!event->squashed()) {
@@ -300,15 +508,16 @@ EventQueue::dump() const
     if (empty())
         cprintf("<No Events>\n");
     else {
-        Event *nextBin = head;
-        while (nextBin) {
+#if USE_CALENDAR_EVENTQ
+        for (Event *nextBin : sortedBins()) {
+#else
+        for (Event *nextBin = head; nextBin; nextBin = nextBin->nextBin) {
+#endif
             Event *nextInBin = nextBin;
             while (nextInBin) {
                 nextInBin->dump();
                 nextInBin = nextInBin->nextInBin;
             }
-
-            nextBin = nextBin->nextBin;
         }
     }
 
@@ -323,8 +532,27 @@ EventQueue::debugVerify() const
     Tick time = 0;
     short priority = 0;
 
-    Event *nextBin = head;
-    while (nextBin) {
+#if USE_CALENDAR_EVENTQ
+    for (size_t bucket = 0; bucket < buckets.size(); ++bucket) {
+        for (Event *bin = buckets[bucket]; bin; bin = bin->nextBin) {
+            if (bucketOf(bin->when()) != bucket) {
+                cprintf("bin in the wrong bucket!");
+                bin->dump();
+                return false;
+            }
+        }
+    }
+
+    std::vector<Event *> sorted = sortedBins();
+    if (sorted.size() != numBins || (head && sorted[0] != head)) {
+        cprintf("bins out of sync!");
+        return false;
+    }
+
+    for (Event *nextBin : sorted) {
+#else
+    for (Event *nextBin = head; nextBin; nextBin = nextBin->nextBin) {
+#endif
         Event *nextInBin = nextBin;
         while (nextInBin) {
             if (nextInBin->when() < time) {
@@ -350,8 +578,6 @@ EventQueue::debugVerify() const
 
             nextInBin = nextInBin->nextInBin;
         }
-
-        nextBin = nextBin->nextBin;
     }
 
     return true;
@@ -360,9 +586,29 @@ EventQueue::debugVerify() const
 Event*
 EventQueue::replaceHead(Event* s)
 {
+#if USE_CALENDAR_EVENTQ
+    // Hand out the bins as the sorted 'nextBin' list the list backend
+    // uses, and take s in the same form
+    std::vector<Event *> all = sortedBins();
+    for (size_t i = 0; i < all.size(); ++i)
+        all[i]->nextBin = i + 1 < all.size() ? all[i + 1] : NULL;
+    Event* t = all.empty() ? NULL : all[0];
+
+    buckets.assign(buckets.size(), NULL);
+    numBins = 0;
+    for (Event *bin = s; bin; ) {
+        Event *next = bin->nextBin;
+        insertBin(bin);
+        ++numBins;
+        bin = next;
+    }
+    head = s;
+    return t;
+#else
     Event* t = head;
     head = s;
     return t;
+#endif
 }
 
 void
@@ -415,6 +661,10 @@ Event::dump() const
 
 EventQueue::EventQueue(const string &n)
     : objName(n), head(NULL), _curTick(0)
+#if USE_CALENDAR_EVENTQ
+      , buckets(minCalendarBuckets, NULL), bucketWidth(initialBucketWidth),
+      numBins(0)
+#endif
 {
 }
 
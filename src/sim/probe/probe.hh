@@ -281,6 +281,9 @@ class ProbePointArg : public ProbePoint
                         listeners.end());
     }
 
+    /** Is anyone listening? Lets call sites skip building the arg. */
+    bool hasListeners() const { return !listeners.empty(); }
+
     /**
      * @brief called at the ProbePoint call site, passes arg to each listener.
      * @param arg the argument to pass to each listener.
@@ -416,6 +416,14 @@ Process::syscall(int64_t callnum, ThreadContext *tc, Fault *fault)
 {
     numSyscalls++;
 
+    // the process state, the page table and the physical page allocator
+    // can be shared by threads on other event queues; emulate the call
+    // on the queue of the system so that only one runs at a time. While
+    // this core's queue is released, other threads may only enter it for
+    // functional snoops of its caches, which are between accesses as the
+    // call comes from commit (see mem/eventq_bridge.hh)
+    EventQueue::ScopedMigration migrate(system->eventQueue(), inParallelMode);
+
     SyscallDesc *desc = getDesc(callnum);
     if (desc == nullptr)
         fatal("Syscall %d out of range", callnum);
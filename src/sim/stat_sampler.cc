@@ -0,0 +1,204 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+#include "sim/stat_sampler.hh"
+
+#include <regex>
+
+#include "base/callback.hh"
+#include "base/logging.hh"
+#include "base/output.hh"
+#include "base/stats/info.hh"
+#include "sim/core.hh"
+
+StatSampler::StatSampler(const Params *p)
+    : SimObject(p), period(p->period), patterns(p->stats),
+      fileName(p->file), rowSize(2), resets(0),
+      ringRows(p->buffer_size), head(0), tail(0), done(false),
+      sampleEvent([this]{ sample(); }, name(), false,
+                  Event::Stat_Event_Pri)
+{
+    fatal_if(period == 0, "%s: the sample period must not be zero\n",
+             name());
+    fatal_if(ringRows < 2, "%s: the buffer needs at least two samples\n",
+             name());
+}
+
+void
+StatSampler::regStats()
+{
+    SimObject::regStats();
+
+    ringStalls
+        .name(name() + ".ringStalls")
+        .desc("Samples that waited for the writer thread to catch up");
+}
+
+void
+StatSampler::startup()
+{
+    // every object has registered its stats by now
+    std::vector<std::regex> regexes;
+    for (auto &pattern : patterns)
+        regexes.emplace_back(pattern);
+
+    std::vector<std::string> names = { "tick", "resets" };
+    std::vector<std::string> descs = { "Tick of the sample",
+                                       "Stats resets before the sample" };
+
+    for (auto info : Stats::statsList()) {
+        bool match = false;
+        for (auto &regex : regexes)
+            match = match || std::regex_search(info->name, regex);
+        if (!match)
+            continue;
+
+        if (auto scalar = dynamic_cast<Stats::ScalarInfo *>(info)) {
+            scalars.push_back(scalar);
+            names.push_back(info->name);
+            descs.push_back(info->desc);
+        } else if (auto vector = dynamic_cast<Stats::VectorInfo *>(info)) {
+            // formulas are vectors too
+            vectors.push_back(vector);
+            for (size_t i = 0; i < vector->size(); ++i) {
+                bool sub = i < vector->subnames.size() &&
+                    !vector->subnames[i].empty();
+                names.push_back(vector->size() == 1 ? info->name :
+                                info->name + info->separatorString +
+                                (sub ? vector->subnames[i] :
+                                 std::to_string(i)));
+                descs.push_back(info->desc);
+            }
+        } else {
+            warn("%s: %s is neither a scalar, a vector nor a formula, "
+                 "not sampled\n", name(), info->name);
+        }
+    }
+
+    if (names.size() == 2)
+        warn("%s: no stats match the patterns to sample\n", name());
+
+    rowSize = names.size();
+    ring.resize(ringRows * rowSize);
+
+    writer.open(*simout.create(fileName, true)->stream());
+    writer.writeSchema(names, descs);
+
+    Stats::registerResetCallback(
+        new MakeCallback<StatSampler, &StatSampler::countReset>(this));
+    registerExitCallback(
+        new MakeCallback<StatSampler, &StatSampler::finish>(this));
+
+    writerThread = std::thread(&StatSampler::writeLoop, this);
+
+    scheduleSample(curTick() + period);
+}
+
+void
+StatSampler::scheduleSample(Tick when)
+{
+    if (numMainEventQueues > 1)
+        new GlobalSampleEvent(this, when);
+    else
+        schedule(sampleEvent, when);
+}
+
+void
+StatSampler::sample()
+{
+    std::unique_lock<std::mutex> lock(ringLock);
+    if (head - tail == ringRows) {
+        ++ringStalls;
+        writerWake.notify_one();
+        spaceFree.wait(lock, [this]{ return head - tail < ringRows; });
+    }
+    lock.unlock();
+
+    Stats::processSampleQueue();
+
+    // the writer never touches the rows from head on
+    Stats::Result *row = &ring[(head % ringRows) * rowSize];
+    *row++ = curTick();
+    *row++ = resets;
+    for (auto scalar : scalars)
+        *row++ = scalar->result();
+    for (auto vector : vectors) {
+        const Stats::VResult &values = vector->result();
+        row = std::copy(values.begin(), values.end(), row);
+    }
+
+    lock.lock();
+    ++head;
+    if (head - tail >= ringRows / 2)
+        writerWake.notify_one();
+    lock.unlock();
+
+    scheduleSample(curTick() + period);
+}
+
+void
+StatSampler::writeLoop()
+{
+    std::unique_lock<std::mutex> lock(ringLock);
+    while (true) {
+        writerWake.wait(lock, [this]{
+            return done || head - tail >= ringRows / 2;
+        });
+
+        uint64_t begin = tail, end = head;
+        lock.unlock();
+
+        for (uint64_t i = begin; i < end; ++i)
+            writer.writeRow(&ring[(i % ringRows) * rowSize], rowSize);
+        writer.flush();
+
+        lock.lock();
+        tail = end;
+        spaceFree.notify_one();
+
+        if (done && tail == head)
+            return;
+    }
+}
+
+void
+StatSampler::finish()
+{
+    {
+        std::lock_guard<std::mutex> lock(ringLock);
+        done = true;
+    }
+    writerWake.notify_one();
+    writerThread.join();
+}
+
+StatSampler *
+StatSamplerParams::create()
+{
+    return new StatSampler(this);
+}
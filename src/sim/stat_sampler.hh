@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Declaration of a sampler that records a few stats at a fixed period.
+ */
+
+#ifndef __SIM_STAT_SAMPLER_HH__
+#define __SIM_STAT_SAMPLER_HH__
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "base/statistics.hh"
+#include "base/stats/binary.hh"
+#include "params/StatSampler.hh"
+#include "sim/eventq.hh"
+#include "sim/global_event.hh"
+#include "sim/sim_object.hh"
+
+/**
+ * Samples the current value of a chosen set of scalar, vector and
+ * formula stats every period, without the dump and reset the periodic
+ * stat dumps need. Every sample is a row of the tick, the number of
+ * stat resets so far and one column per stat value; the values are
+ * cumulative since the last reset, so rates come from the difference
+ * between rows with the same reset count.
+ *
+ * The samples go into a ring buffer that a writer thread flushes to
+ * the output file in the binary stats format (see Stats::BinaryWriter)
+ * once it is half full. The simulation only waits for the writer if
+ * the ring fills up.
+ *
+ * Stats that are only brought up to date at a dump are updated through
+ * the sample callbacks (Stats::registerSampleCallback) first. With
+ * several event queues, the samples are taken at a barrier of all the
+ * queues so a row never mixes stats of queues at different ticks.
+ */
+class StatSampler : public SimObject
+{
+  public:
+    typedef StatSamplerParams Params;
+
+    StatSampler(const Params *p);
+
+    void startup() override;
+
+    void regStats() override;
+
+  private:
+    /** Samples at a barrier of all the event queues */
+    class GlobalSampleEvent : public GlobalEvent
+    {
+      private:
+        StatSampler *sampler;
+
+      public:
+        GlobalSampleEvent(StatSampler *_sampler, Tick when)
+            : GlobalEvent(when, Stat_Event_Pri, AutoDelete),
+              sampler(_sampler)
+        {
+        }
+
+        void process() override { sampler->sample(); }
+
+        const char *description() const override
+        {
+            return "GlobalStatSample";
+        }
+    };
+
+    /** Record one row and schedule the next sample */
+    void sample();
+
+    /** Schedule the next sample, at a barrier with several queues */
+    void scheduleSample(Tick when);
+
+    /** Flush the rows sampled so far from the writer thread */
+    void writeLoop();
+
+    /** Write the remaining rows and stop the writer at exit */
+    void finish();
+
+    /** Count a stats reset, see the reset column */
+    void countReset() { ++resets; }
+
+    const Tick period;
+
+    const std::vector<std::string> patterns;
+
+    const std::string fileName;
+
+    /** The stats to sample, and whether each is a vector */
+    std::vector<Stats::ScalarInfo *> scalars;
+    std::vector<Stats::VectorInfo *> vectors;
+
+    /** Values per row, including the tick and reset columns */
+    size_t rowSize;
+
+    unsigned resets;
+
+    Stats::BinaryWriter writer;
+
+    /**
+     * The ring of rows. The simulation thread fills the rows from head
+     * on, the writer thread empties them from tail on; both only ever
+     * grow and index the ring modulo its size.
+     */
+    std::vector<Stats::Result> ring;
+    const uint64_t ringRows;
+    uint64_t head;
+    uint64_t tail;
+    bool done;
+
+    std::mutex ringLock;
+    /** Wakes the writer when the ring is half full or at exit */
+    std::condition_variable writerWake;
+    /** Wakes the simulation when the writer frees up rows */
+    std::condition_variable spaceFree;
+
+    std::thread writerThread;
+
+    EventFunctionWrapper sampleEvent;
+
+    /** Samples that had to wait for the writer */
+    Stats::Scalar ringStalls;
+};
+
+#endif // __SIM_STAT_SAMPLER_HH__
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/**
+ * @file
+ * Compressed sizes of a few typical block contents under the BDI and
+ * FPC compression models.
+ */
+
+#include <cstring>
+
+#include "mem/cache/compressors/bdi.hh"
+#include "mem/cache/compressors/fpc.hh"
+#include "unittest/unittest.hh"
+
+namespace {
+
+const unsigned blkSize = 64;
+
+template <class T>
+void
+fill(uint8_t *data, unsigned i, T v)
+{
+    std::memcpy(data + i * sizeof(T), &v, sizeof(T));
+}
+
+template <class Compressor>
+Compressor *
+makeCompressor(const char *name)
+{
+    typename Compressor::Params *p = new typename Compressor::Params;
+    p->name = name;
+    p->eventq_index = 0;
+    p->decompression_latency = Cycles(1);
+    return new Compressor(p);
+}
+
+} // anonymous namespace
+
+int
+main(int argc, char *argv[])
+{
+    BDI *bdi = makeCompressor<BDI>("bdi");
+    FPC *fpc = makeCompressor<FPC>("fpc");
+    uint8_t data[blkSize];
+
+    UnitTest::setCase("Zero block");
+    std::memset(data, 0, blkSize);
+    // BDI keeps a single byte, FPC one run of zeros per 8 words
+    EXPECT_EQ(bdi->compressedSize(data, blkSize), 1);
+    EXPECT_EQ(fpc->compressedSize(data, blkSize), 2);
+
+    UnitTest::setCase("Repeated value");
+    for (unsigned i = 0; i < blkSize / 8; ++i)
+        fill<uint64_t>(data, i, 5);
+    // BDI keeps the value once, FPC a 4-bit word and a zero run each
+    EXPECT_EQ(bdi->compressedSize(data, blkSize), 8);
+    EXPECT_EQ(fpc->compressedSize(data, blkSize), 13);
+
+    UnitTest::setCase("Base and deltas");
+    // pointers into one array of 24-byte records
+    for (unsigned i = 0; i < blkSize / 8; ++i)
+        fill<uint64_t>(data, i, 0x7f0000001000ULL + i * 24);
+    // an 8-byte base, 2-byte deltas and a base select bit per value
+    EXPECT_EQ(bdi->compressedSize(data, blkSize), 8 + 8 * 2 + 1);
+    // two 16-bit halfword patterns per pointer
+    EXPECT_EQ(fpc->compressedSize(data, blkSize), 38);
+
+    // small signed integers, around the implicit zero base
+    for (unsigned i = 0; i < blkSize / 4; ++i)
+        fill<int32_t>(data, i, int32_t(i * 3) - 7);
+    EXPECT_EQ(bdi->compressedSize(data, blkSize), 4 + 16 * 1 + 2);
+    EXPECT_EQ(fpc->compressedSize(data, blkSize), 20);
+
+    UnitTest::setCase("Incompressible block");
+    uint32_t v = 0x9e3779b9;
+    for (unsigned i = 0; i < blkSize / 4; ++i) {
+        v = v * 1664525 + 1013904223;
+        fill<uint32_t>(data, i, v | 0x80008000);
+    }
+    EXPECT_EQ(bdi->compressedSize(data, blkSize), blkSize);
+    EXPECT_EQ(fpc->compressedSize(data, blkSize), blkSize);
+
+    return UnitTest::printResults();
+}
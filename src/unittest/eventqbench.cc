@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Event queue microbenchmark.  It keeps a number of events pending the
+ * way a detailed system does: some of them tick on a 500-tick clock, the
+ * rest complete after a random latency, in a handful of priorities, and
+ * some process() calls reschedule another event.
+ *
+ * The backend is chosen at build time, so build it with
+ * USE_CALENDAR_EVENTQ=False and =True and compare the rates.  The order
+ * checksum depends only on the order events are serviced in, so it has
+ * to be the same for both builds.
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+#include "base/cprintf.hh"
+#include "sim/eventq_impl.hh"
+
+using namespace std;
+
+class BenchEvent : public Event
+{
+  private:
+    EventQueue &eq;
+    mt19937_64 &rng;
+    vector<BenchEvent *> &events;
+    uint64_t &checksum;
+    unsigned id;
+
+  public:
+    BenchEvent(EventQueue &_eq, mt19937_64 &_rng,
+               vector<BenchEvent *> &_events, uint64_t &_checksum,
+               unsigned _id, Priority prio)
+        : Event(prio), eq(_eq), rng(_rng), events(_events),
+          checksum(_checksum), id(_id)
+    {}
+
+    void
+    process() override
+    {
+        Tick now = eq.getCurTick();
+        checksum = checksum * 1000003 + id * 7 + now;
+
+        if (id % 16 == 0)
+            eq.schedule(this, now + 500 - now % 500);
+        else
+            eq.schedule(this, now + 1 + rng() % 100000);
+
+        // squashes and wakeups move other events around
+        if (rng() % 8 == 0) {
+            BenchEvent *other = events[rng() % events.size()];
+            if (other != this)
+                eq.reschedule(other, now + rng() % 3000, true);
+        }
+    }
+};
+
+static void
+run(unsigned num_events, unsigned long num_serviced)
+{
+    static const Event::Priority prios[] = {
+        Event::Default_Pri, Event::Default_Pri, Event::CPU_Tick_Pri,
+        Event::Delayed_Writeback_Pri, Event::Stat_Event_Pri
+    };
+
+    EventQueue eq("bench");
+    curEventQueue(&eq);
+
+    mt19937_64 rng(493575226);
+    vector<BenchEvent *> events;
+    uint64_t checksum = 0;
+    for (unsigned i = 0; i < num_events; ++i) {
+        events.push_back(new BenchEvent(eq, rng, events, checksum, i,
+                                        prios[i % 5]));
+    }
+    for (auto event : events)
+        eq.schedule(event, rng() % 1000);
+
+    auto start = chrono::steady_clock::now();
+    for (unsigned long i = 0; i < num_serviced; ++i)
+        eq.serviceOne();
+    chrono::duration<double> secs = chrono::steady_clock::now() - start;
+
+    cprintf("%6d events pending: %8.2f M events/s, checksum %#x\n",
+            num_events, num_serviced / secs.count() / 1e6, checksum);
+
+    for (auto event : events) {
+        if (event->scheduled())
+            eq.deschedule(event);
+        delete event;
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    unsigned long num_serviced = argc > 1 ? atol(argv[1]) : 1000000;
+
+    cprintf("%s event queue, %d events serviced per run\n",
+            USE_CALENDAR_EVENTQ ? "calendar" : "list", num_serviced);
+    for (unsigned num_events = 16; num_events <= 16384; num_events *= 4)
+        run(num_events, num_serviced);
+
+    return 0;
+}
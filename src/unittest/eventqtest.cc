@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met: redistributions of source code must retain the above copyright
+ * notice, this list of conditions and the following disclaimer;
+ * redistributions in binary form must reproduce the above copyright
+ * notice, this list of conditions and the following disclaimer in the
+ * documentation and/or other materials provided with the distribution;
+ * neither the name of the copyright holders nor the names of its
+ * contributors may be used to endorse or promote products derived from
+ * this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+
+/**
+ * @file
+ * Checks the order events are serviced in against a reference model
+ * while they are scheduled, rescheduled and descheduled at random. The
+ * model orders by tick, then priority, then most recently scheduled
+ * first, which is what the sorted list backend does.
+ *
+ * The backend is chosen at build time, so run it in builds with
+ * USE_CALENDAR_EVENTQ=False and =True. The number of pending events is
+ * swept up and back down so that the calendar resizes both ways.
+ */
+
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+
+#include "sim/eventq_impl.hh"
+#include "unittest/unittest.hh"
+
+using namespace std;
+
+namespace {
+
+class TestEvent;
+
+/** when, priority, negated schedule order, event */
+typedef tuple<Tick, Event::Priority, long, TestEvent *> Key;
+
+/** Reference model of an event queue. */
+struct Model
+{
+    set<Key> pending;
+    long stamp = 0;
+    unsigned long misordered = 0;
+    unsigned long serviced = 0;
+    /** Stop scheduling events from process(). */
+    bool draining = false;
+};
+
+class TestEvent : public Event
+{
+  private:
+    EventQueue &eq;
+    mt19937_64 &rng;
+    vector<TestEvent *> &events;
+    Model &model;
+
+  public:
+    /** Position in the model while scheduled. */
+    Key key;
+
+    TestEvent(EventQueue &_eq, mt19937_64 &_rng,
+              vector<TestEvent *> &_events, Model &_model,
+              Priority prio)
+        : Event(prio), eq(_eq), rng(_rng), events(_events), model(_model)
+    {}
+
+    /** Schedules or reschedules the event in both queues. */
+    void
+    at(Tick when)
+    {
+        if (scheduled())
+            model.pending.erase(key);
+        eq.reschedule(this, when, true);
+        key = Key(when, priority(), --model.stamp, this);
+        model.pending.insert(key);
+    }
+
+    /** Deschedules the event from both queues. */
+    void
+    cancel()
+    {
+        model.pending.erase(key);
+        eq.deschedule(this);
+    }
+
+    /** A tick from now, clustered so that bins hold several events. */
+    Tick
+    randomTick()
+    {
+        Tick now = eq.getCurTick();
+        switch (rng() % 8) {
+          case 0:
+            return now;
+          case 1:
+            // far beyond a calendar year
+            return now + 1000000 + rng() % 100000000;
+          default:
+            return now + (rng() % 64) * 500;
+        }
+    }
+
+    void
+    process() override
+    {
+        ++model.serviced;
+        if (model.pending.empty() || get<3>(*model.pending.begin()) != this)
+            ++model.misordered;
+        model.pending.erase(key);
+
+        if (model.draining)
+            return;
+
+        if (rng() % 4 != 0)
+            at(randomTick());
+
+        TestEvent *other = events[rng() % events.size()];
+        if (other != this) {
+            if (rng() % 2 == 0)
+                other->at(randomTick());
+            else if (other->scheduled())
+                other->cancel();
+        }
+    }
+};
+
+/**
+ * Services events until num_serviced have been or the queue is empty,
+ * keeping about num_pending events scheduled.
+ */
+void
+run(EventQueue &eq, mt19937_64 &rng, vector<TestEvent *> &events,
+    Model &model, size_t num_pending, unsigned long num_serviced)
+{
+    for (unsigned long i = 0; i < num_serviced && !eq.empty(); ++i) {
+        while (model.pending.size() < num_pending) {
+            TestEvent *event = events[rng() % num_pending];
+            if (!event->scheduled())
+                event->at(event->randomTick());
+        }
+        while (model.pending.size() > num_pending)
+            get<3>(*model.pending.rbegin())->cancel();
+
+        eq.serviceOne();
+    }
+}
+
+} // anonymous namespace
+
+int
+main()
+{
+    static const Event::Priority prios[] = {
+        Event::Minimum_Pri, Event::Default_Pri, Event::CPU_Tick_Pri,
+        Event::Stat_Event_Pri, Event::Maximum_Pri
+    };
+    static const size_t maxPending = 8192;
+
+    EventQueue eq("test");
+    curEventQueue(&eq);
+
+    mt19937_64 rng(1234567);
+    Model model;
+    vector<TestEvent *> events;
+    for (size_t i = 0; i < maxPending; ++i) {
+        events.push_back(new TestEvent(eq, rng, events, model,
+                                       prios[i % 5]));
+    }
+    events[0]->at(0);
+
+    UnitTest::setCase("Growing queue");
+    for (size_t pending = 4; pending <= maxPending; pending *= 8) {
+        run(eq, rng, events, model, pending, 20000);
+        EXPECT_EQ(model.misordered, 0);
+        EXPECT_TRUE(eq.debugVerify());
+    }
+
+    UnitTest::setCase("Shrinking queue");
+    for (size_t pending = maxPending; pending >= 4; pending /= 8) {
+        run(eq, rng, events, model, pending, 20000);
+        EXPECT_EQ(model.misordered, 0);
+        EXPECT_TRUE(eq.debugVerify());
+    }
+
+    UnitTest::setCase("Draining queue");
+    model.draining = true;
+    while (!eq.empty())
+        eq.serviceOne();
+    EXPECT_EQ(model.misordered, 0);
+    EXPECT_TRUE(model.pending.empty());
+
+    for (auto event : events)
+        delete event;
+
+    return UnitTest::printResults();
+}
@@ -0,0 +1,38 @@
+// A[B[i]] gather over a random index array, the access pattern the
+// indirect memory prefetcher is meant to cover
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#define NUM_TARGETS (1 << 20)
+#define NUM_INDICES (1 << 16)
+
+int
+main(int argc, char *argv[])
+{
+    int iters = argc > 1 ? atoi(argv[1]) : 4;
+
+    int64_t *A = (int64_t *)malloc(NUM_TARGETS * sizeof(int64_t));
+    int32_t *B = (int32_t *)malloc(NUM_INDICES * sizeof(int32_t));
+    if (!A || !B) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (int i = 0; i < NUM_TARGETS; i++)
+        A[i] = i;
+    srand(1);
+    for (int i = 0; i < NUM_INDICES; i++)
+        B[i] = rand() % NUM_TARGETS;
+
+    int64_t sum = 0;
+    for (int it = 0; it < iters; it++)
+        for (int i = 0; i < NUM_INDICES; i++)
+            sum += A[B[i]];
+
+    printf("sum = %lld\n", (long long)sum);
+    free(A);
+    free(B);
+    return 0;
+}